@@ -10,7 +10,7 @@
 #include <libacars/libacars.h>  /* la_proto_node, la_msg_dir,
                                    la_proto_tree_format_text(), la_proto_tree_destroy() */
 #include <libacars/acars.h>     /* la_acars_decode_apps() */
-#include <libacars/vstring.h>   /* la_vstring, la_vstring_destroy() */
+#include <libacars/vstring.h>   /* la_vstring, la_vstring_pool_put(), la_vstring_pool_clear() */
 
 void usage() {
 	fprintf(stderr,
@@ -65,7 +65,8 @@ void parse(char *label, char *txt, la_msg_dir msg_dir) {
 		}
 		fwrite(vstr->str, sizeof(char), vstr->len, stdout);
 		fputc('\n', stdout);
-		la_vstring_destroy(vstr, true);
+		/* Keep the buffer for reuse by the next message */
+		la_vstring_pool_put(vstr);
 	}
 	la_proto_tree_destroy(node);
 }
@@ -144,4 +145,6 @@ int main(int argc, char **argv) {
 		usage();
 		exit(1);
 	}
+	/* Release buffers kept for reuse by la_vstring_pool_put() */
+	la_vstring_pool_clear();
 }
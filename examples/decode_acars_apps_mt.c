@@ -0,0 +1,212 @@
+/*
+ *  decode_acars_apps_mt - a multi-threaded example decoder for ACARS applications
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+#include <stdbool.h>            /* true */
+#include <stdint.h>             /* uint64_t */
+#include <stdio.h>              /* printf(), fprintf(), fgets() */
+#include <stdlib.h>             /* exit(), strtol(), calloc(), realloc() */
+#include <string.h>             /* strcmp(), strchr(), strlen(), strdup() */
+#include <unistd.h>             /* getopt() */
+#include <pthread.h>            /* pthread_create(), pthread_join() */
+#include <libacars/libacars.h>  /* la_proto_node, la_msg_dir, la_config_snapshot_*(),
+                                   la_proto_tree_format_*(), la_proto_tree_destroy() */
+#include <libacars/acars.h>     /* la_acars_decode_apps() */
+#include <libacars/vstring.h>   /* la_vstring, la_vstring_pool_put(), la_vstring_pool_clear() */
+
+#define DEFAULT_THREAD_CNT 4
+#define DEFAULT_ITERATION_CNT 10
+
+void usage() {
+	fprintf(stderr,
+			"decode_acars_apps_mt - a multi-threaded example decoder of ACARS applications\n"
+			"(c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>\n\n"
+			"Usage: ./decode_acars_apps_mt [-t <thread_count>] [-n <iteration_count>] < messages.txt\n\n"
+			"Reads messages from standard input, in the format accepted by decode_acars_apps\n"
+			"('u|d label acars_message_text', one message per line). Then it starts\n"
+			"<thread_count> threads (default: %d), each of which decodes all messages\n"
+			"<iteration_count> times (default: %d) and formats them as text and JSON.\n"
+			"Each thread uses its own configuration snapshot. Finally it verifies that\n"
+			"all threads have produced the same output for each message.\n\n"
+			"The program is meant to exercise the library in multiple threads at once.\n"
+			"Build it with -DCMAKE_C_FLAGS=-fsanitize=thread to check the library\n"
+			"for data races with ThreadSanitizer.\n",
+			DEFAULT_THREAD_CNT, DEFAULT_ITERATION_CNT
+			);
+}
+
+typedef struct {
+	char label[3];
+	char *txt;
+	la_msg_dir msg_dir;
+} message;
+
+typedef struct {
+	pthread_t tid;
+	uint64_t *hashes;           /* output hash for each message */
+	bool mismatch;              /* output has changed between iterations */
+} worker;
+
+message *messages = NULL;
+int message_cnt = 0;
+int iteration_cnt = DEFAULT_ITERATION_CNT;
+
+/* FNV-1a */
+uint64_t hash_update(uint64_t hash, char const *buf, size_t len) {
+	for(size_t i = 0; i < len; i++) {
+		hash ^= (uint8_t)buf[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+uint64_t decode(message const *msg) {
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	int offset = la_acars_extract_sublabel_and_mfi(msg->label, msg->msg_dir, msg->txt,
+			strlen(msg->txt), NULL, NULL);
+	la_proto_node *node = la_acars_decode_apps(msg->label, msg->txt + offset, msg->msg_dir);
+	if(node != NULL) {
+		la_vstring *vstr = la_proto_tree_format_text(NULL, node);
+		hash = hash_update(hash, vstr->str, vstr->len);
+		la_vstring_pool_put(vstr);
+		vstr = la_proto_tree_format_json(NULL, node);
+		hash = hash_update(hash, vstr->str, vstr->len);
+		la_vstring_pool_put(vstr);
+	}
+	la_proto_tree_destroy(node);
+	return hash;
+}
+
+void *worker_thread(void *arg) {
+	worker *w = arg;
+	/* Each thread gets its own copy of the global configuration,
+	 * which is left untouched */
+	la_config_snapshot *snap = la_config_snapshot_new();
+	la_config_snapshot_set_bool(snap, "prettify_xml", true);
+	la_config_snapshot_set_bool(snap, "prettify_json", true);
+	la_config_snapshot_bind(snap);
+	for(int i = 0; i < iteration_cnt; i++) {
+		for(int m = 0; m < message_cnt; m++) {
+			uint64_t hash = decode(messages + m);
+			if(i == 0) {
+				w->hashes[m] = hash;
+			} else if(hash != w->hashes[m]) {
+				w->mismatch = true;
+			}
+		}
+	}
+	la_config_snapshot_bind(NULL);
+	la_config_snapshot_destroy(snap);
+	/* Release buffers kept by this thread for reuse */
+	la_vstring_pool_clear();
+	return NULL;
+}
+
+void read_messages() {
+	char buf[10240];
+	int messages_allocated = 0;
+	while(fgets(buf, sizeof(buf), stdin) != NULL) {
+		char *end = strchr(buf, '\n');
+		if(end)
+			*end = '\0';
+		if(strlen(buf) < 6 ||
+				(buf[0] != 'u' && buf[0] != 'd') ||
+				buf[1] != ' ' ||
+				buf[2] == ' ' ||
+				buf[3] == ' ' ||
+				buf[4] != ' '
+		  ) {
+			fprintf(stderr, "Garbled input: expecting 'u|d label acars_message_text'\n");
+			continue;
+		}
+		if(message_cnt == messages_allocated) {
+			messages_allocated = messages_allocated > 0 ? 2 * messages_allocated : 64;
+			messages = realloc(messages, messages_allocated * sizeof(message));
+			if(messages == NULL) {
+				perror("realloc");
+				exit(1);
+			}
+		}
+		message *msg = messages + message_cnt++;
+		msg->msg_dir = buf[0] == 'u' ? LA_MSG_DIR_GND2AIR : LA_MSG_DIR_AIR2GND;
+		msg->label[0] = buf[2];
+		msg->label[1] = buf[3];
+		msg->label[2] = '\0';
+		msg->txt = strdup(buf + 5);
+	}
+}
+
+int main(int argc, char **argv) {
+	int thread_cnt = DEFAULT_THREAD_CNT;
+	int opt;
+	while((opt = getopt(argc, argv, "t:n:h")) != -1) {
+		switch(opt) {
+			case 't':
+				thread_cnt = (int)strtol(optarg, NULL, 10);
+				break;
+			case 'n':
+				iteration_cnt = (int)strtol(optarg, NULL, 10);
+				break;
+			default:
+				usage();
+				exit(opt == 'h' ? 0 : 1);
+		}
+	}
+	if(thread_cnt < 1 || iteration_cnt < 1) {
+		fprintf(stderr, "Thread count and iteration count must be positive\n");
+		exit(1);
+	}
+
+	read_messages();
+	if(message_cnt == 0) {
+		fprintf(stderr, "No messages to decode\n");
+		exit(1);
+	}
+
+	worker *workers = calloc(thread_cnt, sizeof(worker));
+	if(workers == NULL) {
+		perror("calloc");
+		exit(1);
+	}
+	for(int t = 0; t < thread_cnt; t++) {
+		workers[t].hashes = calloc(message_cnt, sizeof(uint64_t));
+		if(workers[t].hashes == NULL) {
+			perror("calloc");
+			exit(1);
+		}
+		if(pthread_create(&workers[t].tid, NULL, worker_thread, workers + t) != 0) {
+			fprintf(stderr, "Could not start thread %d\n", t);
+			exit(1);
+		}
+	}
+	for(int t = 0; t < thread_cnt; t++) {
+		pthread_join(workers[t].tid, NULL);
+	}
+
+	int errors = 0;
+	for(int t = 0; t < thread_cnt; t++) {
+		if(workers[t].mismatch) {
+			fprintf(stderr, "Thread %d: output changed between iterations\n", t);
+			errors++;
+		}
+		for(int m = 0; m < message_cnt; m++) {
+			if(workers[t].hashes[m] != workers[0].hashes[m]) {
+				fprintf(stderr, "Thread %d: output of message %d differs from thread 0\n", t, m + 1);
+				errors++;
+			}
+		}
+	}
+	printf("%d threads, %d iterations, %d messages: %s\n", thread_cnt, iteration_cnt,
+			message_cnt, errors == 0 ? "OK" : "FAILED");
+
+	for(int t = 0; t < thread_cnt; t++) {
+		free(workers[t].hashes);
+	}
+	free(workers);
+	for(int m = 0; m < message_cnt; m++) {
+		free(messages[m].txt);
+	}
+	free(messages);
+	return errors == 0 ? 0 : 1;
+}
@@ -21,12 +21,15 @@
 #include <libacars/crc.h>                   // la_crc16_ccitt()
 #include <libacars/vstring.h>               // la_vstring, LA_ISPRINTF()
 #include <libacars/json.h>                  // la_json_append_*()
-#include <libacars/util.h>                  // LA_XCALLOC, LA_XFREE, la_prettify_xml
+#include <libacars/util.h>                  // LA_XCALLOC, LA_XFREE, la_prettify_xml, la_strpack
 #include <libacars/hash.h>                  // LA_HASH_INIT, la_hash_string()
 #include <libacars/reassembly.h>
+#include <libacars/configuration.h>         // la_config_current()
+#include <libacars/reassembly-builtin.h>    // la_acars_reasm_table_get()
 #include <libacars/acars.h>
 
 #define LA_ACARS_PREAMBLE_LEN    16         // including CRC and DEL, not including SOH
+#define LA_ACARS_TEXT_OFFSET     13         // mode, reg, ack, label, block ID, STX
 #define DEL 0x7f
 #define STX 0x02
 #define ETX 0x03
@@ -37,9 +40,8 @@
 
 #define LA_ACARS_REASM_TABLE_CLEANUP_INTERVAL 1000
 
-typedef struct {
-	struct timeval downlink, uplink;
-} la_acars_timeout_profile;
+// Number of frames processed by la_acars_parse_batch() in a single CRC pass
+#define LA_ACARS_BATCH_CHUNK_SIZE 64
 
 // Reassembly timers for various ACARS radio bearers.
 static la_acars_timeout_profile const timeout_profiles[] = {
@@ -66,24 +68,33 @@ static la_acars_timeout_profile const timeout_profiles[] = {
 	}
 };
 
+// ACARS reassembly key. Registration, label and message number are
+// zero-padded and packed into two 64-bit words, so that keys can be compared
+// with two integer comparisons. The hash of the key is computed once, when
+// the key is built.
 typedef struct {
-	char *reg, *label, *msg_num;
+	union {
+		struct {
+			char reg[8];
+			char label[2];
+			char msg_num[3];
+			char pad[3];
+		} f;
+		uint64_t w[2];
+	} packed;
+	uint64_t hash;
 } la_acars_key;
 
 static uint32_t la_acars_key_hash(void const *key) {
-	la_acars_key *k = (la_acars_key *)key;
-	uint32_t h = la_hash_string(k->reg, LA_HASH_INIT);
-	h = la_hash_string(k->label, h);
-	h = la_hash_string(k->msg_num, h);
-	return h;
+	la_acars_key const *k = key;
+	return la_hash_fold64(k->hash);
 }
 
 static bool la_acars_key_compare(void const *key1, void const *key2) {
 	la_acars_key const *k1 = key1;
 	la_acars_key const *k2 = key2;
-	return (!strcmp(k1->reg, k2->reg) &&
-			!strcmp(k1->label, k2->label) &&
-			!strcmp(k1->msg_num, k2->msg_num));
+	return k1->packed.w[0] == k2->packed.w[0] &&
+		k1->packed.w[1] == k2->packed.w[1];
 }
 
 static void la_acars_key_destroy(void *ptr) {
@@ -91,42 +102,75 @@ static void la_acars_key_destroy(void *ptr) {
 		return;
 	}
 	la_acars_key *key = ptr;
-	la_debug_print(D_INFO, "DESTROY KEY %s %s %s\n", key->reg, key->label, key->msg_num);
-	LA_XFREE(key->reg);
-	LA_XFREE(key->label);
-	LA_XFREE(key->msg_num);
+	la_debug_print(D_INFO, "DESTROY KEY %.8s %.2s %.3s\n",
+			key->packed.f.reg, key->packed.f.label, key->packed.f.msg_num);
 	LA_XFREE(key);
 }
 
-static void *la_acars_tmp_key_get(void const *msg) {
+static void la_acars_tmp_key_fill(void *keyptr, void const *msg) {
+	la_assert(keyptr != NULL);
 	la_assert(msg != NULL);
 	la_acars_msg const *amsg = msg;
+	la_acars_key *key = keyptr;
+	memset(&key->packed, 0, sizeof(key->packed));
+	la_strpack(key->packed.f.reg, amsg->reg, sizeof(key->packed.f.reg));
+	la_strpack(key->packed.f.label, amsg->label, sizeof(key->packed.f.label));
+	la_strpack(key->packed.f.msg_num, amsg->msg_num, sizeof(key->packed.f.msg_num));
+	key->hash = la_hash_mix64(la_hash_mix64(LA_HASH_INIT, key->packed.w[0]), key->packed.w[1]);
+}
+
+// The serialized key is just the packed part (it consists of characters only,
+// so it does not depend on byte order).
+static size_t la_acars_key_serialize(void const *keyptr, uint8_t *buf, size_t len) {
+	la_assert(keyptr != NULL);
+	la_acars_key const *key = keyptr;
+	if(len >= sizeof(key->packed)) {
+		memcpy(buf, &key->packed, sizeof(key->packed));
+	}
+	return sizeof(key->packed);
+}
+
+static void *la_acars_key_deserialize(uint8_t const *buf, size_t len) {
+	la_assert(buf != NULL);
+	if(len != sizeof(((la_acars_key *)NULL)->packed)) {
+		return NULL;
+	}
 	LA_NEW(la_acars_key, key);
-	key->reg = (char *)amsg->reg;
-	key->label = (char *)amsg->label;
-	key->msg_num = (char *)amsg->msg_num;
-	return (void *)key;
+	memcpy(&key->packed, buf, len);
+	key->hash = la_hash_mix64(la_hash_mix64(LA_HASH_INIT, key->packed.w[0]), key->packed.w[1]);
+	return key;
 }
 
 static void *la_acars_key_get(void const *msg) {
 	la_assert(msg != NULL);
-	la_acars_msg const *amsg = msg;
 	LA_NEW(la_acars_key, key);
-	key->reg = strdup(amsg->reg);
-	key->label = strdup(amsg->label);
-	key->msg_num = strdup(amsg->msg_num);
-	la_debug_print(D_INFO, "ALLOC KEY %s %s %s\n", key->reg, key->label, key->msg_num);
+	la_acars_tmp_key_fill(key, msg);
+	la_debug_print(D_INFO, "ALLOC KEY %.8s %.2s %.3s\n",
+			key->packed.f.reg, key->packed.f.label, key->packed.f.msg_num);
 	return (void *)key;
 }
 
-static la_reasm_table_funcs acars_reasm_funcs = {
+static la_reasm_table_funcs_ex acars_reasm_funcs = {
 	.get_key = la_acars_key_get,
-	.get_tmp_key = la_acars_tmp_key_get,
+	.fill_tmp_key = la_acars_tmp_key_fill,
+	.tmp_key_size = sizeof(la_acars_key),
 	.hash_key = la_acars_key_hash,
 	.compare_keys = la_acars_key_compare,
-	.destroy_key = la_acars_key_destroy
+	.destroy_key = la_acars_key_destroy,
+	.name = "acars",
+	.serialize_key = la_acars_key_serialize,
+	.deserialize_key = la_acars_key_deserialize
 };
 
+la_reasm_table *la_acars_reasm_table_get(la_reasm_ctx *rctx) {
+	la_reasm_table *rtable = la_reasm_table_lookup(rctx, &la_DEF_acars_message);
+	if(rtable == NULL) {
+		rtable = la_reasm_table_new_ex(rctx, &la_DEF_acars_message,
+				acars_reasm_funcs, LA_ACARS_REASM_TABLE_CLEANUP_INTERVAL);
+	}
+	return rtable;
+}
+
 la_proto_node *la_acars_apps_parse_and_reassemble(char const *reg,
 		char const *label, char const *txt, la_msg_dir msg_dir,
 		la_reasm_ctx *rtables, struct timeval rx_time) {
@@ -267,19 +311,57 @@ end:
 	return consumed;
 }
 
-// Note: buf must contain raw ACARS bytes, NOT including initial SOH byte
-// (0x01) and including terminating DEL byte (0x7f).
-la_proto_node *la_acars_parse_and_reassemble(uint8_t const* buf, int len, la_msg_dir msg_dir,
-		la_reasm_ctx *rtables, struct timeval rx_time) {
-	if(buf == NULL) {
+// Parser state which is shared by all frames in a batch, so that the
+// reassembly table lookup and configuration reads are done once per batch
+// rather than once per frame. Single-frame parsing routines use a fresh,
+// zero-initialized instance for each call.
+// timeout_profile may be set by the caller before parsing. Otherwise it's
+// taken from the configuration.
+typedef struct {
+	la_reasm_table *rtable;
+	la_acars_timeout_profile const *timeout_profile;
+	bool decode_fragments;
+	bool config_loaded;
+} la_acars_parse_state;
+
+static void la_acars_parse_state_load_config(la_acars_parse_state *state,
+		la_reasm_ctx const *rtables) {
+	if(state->config_loaded) {
+		return;
+	}
+	la_config_snapshot const *config = la_config_current(rtables);
+	if(state->timeout_profile == NULL) {
+		state->timeout_profile = &config->acars_timeout_profile;
+	}
+	state->decode_fragments = config->decode_fragments;
+	state->config_loaded = true;
+}
+
+// Returns reassembly timeouts for the given bearer (one of LA_ACARS_BEARER_*
+// constants) or NULL if the bearer is invalid.
+la_acars_timeout_profile const *la_acars_timeout_profile_get(long int bearer) {
+	if(bearer <= LA_ACARS_BEARER_INVALID || bearer > LA_ACARS_BEARER_MAX) {
 		return NULL;
 	}
+	return timeout_profiles + bearer;
+}
 
+// Common ACARS parsing routine.
+// buf must contain raw ACARS bytes, NOT including initial SOH byte (0x01)
+// and including terminating DEL byte (0x7f).
+// buf2 is a work buffer of at least len bytes, where the message is stored
+// after parity bit removal. If in_place is true, then buf2 is the same
+// buffer as buf and it is owned by the caller - in this case message text is
+// not copied but is referenced directly in the caller's buffer.
+// If crc is not NULL, it points to the CRC of the frame (not including the
+// DEL byte) which has already been computed by the caller.
+static la_proto_node *la_acars_parse_and_reassemble_common(uint8_t const *buf, char *buf2,
+		int len, la_msg_dir msg_dir, la_reasm_ctx *rtables, struct timeval rx_time,
+		bool in_place, la_acars_parse_state *state, uint16_t const *crc_precomputed) {
 	la_proto_node *node = la_proto_node_new();
 	LA_NEW(la_acars_msg, msg);
 	node->data = msg;
 	node->td = &la_DEF_acars_message;
-	char *buf2 = LA_XCALLOC(len, sizeof(char));
 
 	msg->err = false;
 	if(len < LA_ACARS_PREAMBLE_LEN) {
@@ -293,15 +375,26 @@ la_proto_node *la_acars_parse_and_reassemble(uint8_t const* buf, int len, la_msg
 	}
 	len--;
 
-	uint16_t crc = la_crc16_ccitt(buf, len, 0);
-	la_debug_print(D_INFO, "CRC check result: %04x\n", crc);
+	// Verify CRC, strip parity bits and replace NULLs in the message text
+	// to make it printable - all in a single pass over the buffer.
+	// The text (if present) starts after the STX byte and ends before
+	// the ETX/ETB byte which precedes the CRC.
+	// XXX: Should we replace all nonprintable chars here?
+	uint32_t parity_err_cnt = 0;
+	uint16_t crc;
+	if(crc_precomputed != NULL) {
+		crc = *crc_precomputed;
+		parity_err_cnt = la_strip_parity(buf, (uint8_t *)buf2, len - 2,
+				LA_ACARS_TEXT_OFFSET, len - 3);
+	} else {
+		crc = la_crc16_ccitt_strip_parity(buf, (uint8_t *)buf2, len, len - 2,
+				LA_ACARS_TEXT_OFFSET, len - 3, &parity_err_cnt, 0);
+	}
+	la_debug_print(D_INFO, "CRC check result: %04x, parity errors: %u\n", crc, parity_err_cnt);
+	msg->parity_err_cnt = parity_err_cnt > UINT16_MAX ? UINT16_MAX : parity_err_cnt;
 	len -= 2;
 	msg->crc_ok = (crc == 0);
 
-	int i = 0;
-	for(i = 0; i < len; i++) {
-		buf2[i] = buf[i] & 0x7f;
-	}
 	la_debug_print_buf_hex(D_VERBOSE, buf2, len, "After CRC and parity bit removal:\n");
 	la_debug_print(D_INFO, "Length: %d\n", len);
 
@@ -369,7 +462,15 @@ la_proto_node *la_acars_parse_and_reassemble(uint8_t const* buf, int len, la_msg
 		// empty ACKs (label: _<7F> aka _d), because they have out-of-sequence
 		// block IDs (X, Y, Z, X, ...).
 		if(!IS_DOWNLINK_BLK(msg->block_id)) {
-			msg->txt = strdup("");
+			if(in_place) {
+				// Reuse the ETX/ETB byte position as the string terminator
+				buf2[len] = '\0';
+				msg->txt = buf2 + len;
+				msg->flags |= LA_ACARS_MSG_TXT_BORROWED;
+			} else {
+				msg->txt = LA_XSTRDUP("");
+			}
+			msg->txt_len = 0;
 			msg->reasm_status = LA_REASM_SKIPPED;
 			goto end;
 		} else {
@@ -383,14 +484,8 @@ la_proto_node *la_acars_parse_and_reassemble(uint8_t const* buf, int len, la_msg
 		goto fail;
 	}
 	ptr++; remaining--;
+	la_assert(ptr - buf2 == LA_ACARS_TEXT_OFFSET);
 
-	// Replace NULLs in message text to make it printable
-	// XXX: Should we replace all nonprintable chars here?
-	for(i = 0; i < remaining; i++) {
-		if(ptr[i] == 0) {
-			ptr[i] = '.';
-		}
-	}
 	// Extract downlink-specific fields from message text
 	if (IS_DOWNLINK_BLK(msg->block_id)) {
 		if(remaining < 10) {
@@ -415,22 +510,17 @@ la_proto_node *la_acars_parse_and_reassemble(uint8_t const* buf, int len, la_msg
 
 	la_reasm_table *acars_rtable = NULL;
 	if(rtables != NULL) {       // reassembly engine is enabled
-		acars_rtable = la_reasm_table_lookup(rtables, &la_DEF_acars_message);
-		if(acars_rtable == NULL) {
-			acars_rtable = la_reasm_table_new(rtables, &la_DEF_acars_message,
-					acars_reasm_funcs, LA_ACARS_REASM_TABLE_CLEANUP_INTERVAL);
+		if(state->rtable == NULL) {
+			state->rtable = la_acars_reasm_table_get(rtables);
 		}
+		acars_rtable = state->rtable;
 		bool down = IS_DOWNLINK_BLK(msg->block_id);
 
-		long int acars_bearer = LA_ACARS_BEARER_INVALID;
-		(void)la_config_get_int("acars_bearer", &acars_bearer);
-		if(acars_bearer < LA_ACARS_BEARER_MIN || acars_bearer > LA_ACARS_BEARER_MAX) {
-			// This bearer will cause reassembly to fail with LA_REASM_INVALID_ARGS
-			acars_bearer = LA_ACARS_BEARER_INVALID;
-		}
-		la_acars_timeout_profile const *timeout_profile = timeout_profiles + acars_bearer;
-		la_debug_print(D_VERBOSE, "Using timeout profile for bearer %ld (up: %lu dn: %lu)\n",
-				acars_bearer,
+		la_acars_parse_state_load_config(state, rtables);
+		// Zero timeouts (invalid bearer) will cause reassembly to fail
+		// with LA_REASM_ARGS_INVALID
+		la_acars_timeout_profile const *timeout_profile = state->timeout_profile;
+		la_debug_print(D_VERBOSE, "Using timeout profile up: %lu dn: %lu\n",
 				timeout_profile->uplink.tv_sec,
 				timeout_profile->downlink.tv_sec);
 
@@ -450,27 +540,39 @@ la_proto_node *la_acars_parse_and_reassemble(uint8_t const* buf, int len, la_msg
 				});
 	}
 	uint8_t *reassembled_msg = NULL;
+	int reassembled_len = 0;
 	if(msg->reasm_status == LA_REASM_COMPLETE &&
-			la_reasm_payload_get(acars_rtable, msg, &reassembled_msg) > 0) {
+			(reassembled_len = la_reasm_payload_get(acars_rtable, msg, &reassembled_msg)) > 0) {
 		// reassembled_msg is a newly allocated byte buffer, which is guaranteed to
 		// be NULL-terminated, so we can cast it to char * directly.
 		msg->txt = (char *)reassembled_msg;
+		msg->txt_len = reassembled_len;
+
+	} else if(in_place) {
+		// The text ends right before the ETX/ETB byte, which is not needed
+		// anymore, so it can be overwritten with the string terminator.
+		ptr[remaining] = '\0';
+		msg->txt = ptr;
+		msg->txt_len = remaining;
+		msg->flags |= LA_ACARS_MSG_TXT_BORROWED;
 
 	} else {        // this will also trigger when reassembly engine is disabled
 		msg->txt = LA_XCALLOC(remaining + 1, sizeof(char));
 		if(remaining > 0) {
 			memcpy(msg->txt, ptr, remaining);
 		}
+		msg->txt_len = remaining;
 	}
 
-	if(strlen(msg->txt) > 0) {
+	if(msg->txt[0] != '\0') {
 		bool decode_apps = true;
 		// If reassembly is enabled and is now in progress (ie. the message is not yet complete),
 		// then decode_fragments config flag decides whether to decode apps in this message
 		// or not.
 		if(rtables != NULL && (msg->reasm_status == LA_REASM_IN_PROGRESS ||
 					msg->reasm_status == LA_REASM_DUPLICATE)) {
-			(void)la_config_get_bool("decode_fragments", &decode_apps);
+			la_acars_parse_state_load_config(state, rtables);
+			decode_apps = state->decode_fragments;
 		}
 		if(decode_apps) {
 			node->next = la_acars_apps_parse_and_reassemble(msg->reg, msg->label,
@@ -481,15 +583,118 @@ la_proto_node *la_acars_parse_and_reassemble(uint8_t const* buf, int len, la_msg
 fail:
 	msg->err = true;
 end:
+	return node;
+}
+
+// Note: buf must contain raw ACARS bytes, NOT including initial SOH byte
+// (0x01) and including terminating DEL byte (0x7f).
+// If timeout_profile is NULL, reassembly timeouts are determined by the
+// configuration (acars_bearer).
+la_proto_node *la_acars_parse_and_reassemble_with_profile(uint8_t const *buf, int len,
+		la_msg_dir msg_dir, la_reasm_ctx *rtables, struct timeval rx_time,
+		la_acars_timeout_profile const *timeout_profile) {
+	if(buf == NULL) {
+		return NULL;
+	}
+	char *buf2 = LA_XCALLOC(len, sizeof(char));
+	la_proto_node *node = la_acars_parse_and_reassemble_common(buf, buf2, len,
+			msg_dir, rtables, rx_time, false,
+			&(la_acars_parse_state){ .timeout_profile = timeout_profile }, NULL);
 	LA_XFREE(buf2);
 	return node;
 }
 
+la_proto_node *la_acars_parse_and_reassemble(uint8_t const* buf, int len, la_msg_dir msg_dir,
+		la_reasm_ctx *rtables, struct timeval rx_time) {
+	return la_acars_parse_and_reassemble_with_profile(buf, len, msg_dir, rtables, rx_time, NULL);
+}
+
 la_proto_node *la_acars_parse(uint8_t const *buf, int len, la_msg_dir msg_dir) {
 	return la_acars_parse_and_reassemble(buf, len, msg_dir, NULL,
 			(struct timeval){ .tv_sec = 0, .tv_usec = 0 });
 }
 
+// Same as la_acars_parse_and_reassemble(), but parity bits are stripped
+// in place and the message text is not copied, unless it has been
+// reassembled from multiple blocks. The buffer is modified and must remain
+// valid for the lifetime of the returned protocol tree.
+la_proto_node *la_acars_parse_and_reassemble_inplace_with_profile(uint8_t *buf, int len,
+		la_msg_dir msg_dir, la_reasm_ctx *rtables, struct timeval rx_time,
+		la_acars_timeout_profile const *timeout_profile) {
+	if(buf == NULL) {
+		return NULL;
+	}
+	return la_acars_parse_and_reassemble_common(buf, (char *)buf, len,
+			msg_dir, rtables, rx_time, true,
+			&(la_acars_parse_state){ .timeout_profile = timeout_profile }, NULL);
+}
+
+la_proto_node *la_acars_parse_and_reassemble_inplace(uint8_t *buf, int len, la_msg_dir msg_dir,
+		la_reasm_ctx *rtables, struct timeval rx_time) {
+	return la_acars_parse_and_reassemble_inplace_with_profile(buf, len, msg_dir,
+			rtables, rx_time, NULL);
+}
+
+la_proto_node *la_acars_parse_inplace(uint8_t *buf, int len, la_msg_dir msg_dir) {
+	return la_acars_parse_and_reassemble_inplace(buf, len, msg_dir, NULL,
+			(struct timeval){ .tv_sec = 0, .tv_usec = 0 });
+}
+
+// Parses cnt ACARS frames and stores the resulting protocol trees in
+// results[0..cnt-1]. Frames are processed in order, so the outcome is the same
+// as calling la_acars_parse_and_reassemble() on each of them in turn, but
+// the per-frame overhead is lower: CRCs are computed for multiple frames at
+// once, the work buffer is allocated once and the reassembly table lookup and
+// configuration reads are done once per batch.
+// A NULL is stored in results[i] if frames[i].buf is NULL.
+void la_acars_parse_batch_with_profile(la_acars_frame const *frames, size_t cnt,
+		la_reasm_ctx *rtables, la_acars_timeout_profile const *timeout_profile,
+		la_proto_node **results) {
+	if(frames == NULL || results == NULL || cnt == 0) {
+		return;
+	}
+	int max_len = 1;
+	for(size_t i = 0; i < cnt; i++) {
+		if(frames[i].buf != NULL && frames[i].len > max_len) {
+			max_len = frames[i].len;
+		}
+	}
+	char *buf2 = LA_XCALLOC(max_len, sizeof(char));
+	la_acars_parse_state state = { .timeout_profile = timeout_profile };
+	la_octet_string crc_bufs[LA_ACARS_BATCH_CHUNK_SIZE];
+	uint16_t crcs[LA_ACARS_BATCH_CHUNK_SIZE];
+
+	for(size_t start = 0; start < cnt; start += LA_ACARS_BATCH_CHUNK_SIZE) {
+		size_t n = cnt - start;
+		if(n > LA_ACARS_BATCH_CHUNK_SIZE) {
+			n = LA_ACARS_BATCH_CHUNK_SIZE;
+		}
+		la_acars_frame const *f = frames + start;
+		for(size_t i = 0; i < n; i++) {
+			// CRC covers all bytes except the trailing DEL. Frames which are
+			// too short are rejected by the parser before the CRC is checked.
+			crc_bufs[i].buf = (uint8_t *)f[i].buf;
+			crc_bufs[i].len = f[i].buf != NULL && f[i].len >= LA_ACARS_PREAMBLE_LEN ?
+				(size_t)f[i].len - 1 : 0;
+		}
+		la_crc16_ccitt_batch(crc_bufs, n, 0, crcs);
+		for(size_t i = 0; i < n; i++) {
+			if(f[i].buf == NULL) {
+				results[start + i] = NULL;
+				continue;
+			}
+			results[start + i] = la_acars_parse_and_reassemble_common(f[i].buf, buf2,
+					f[i].len, f[i].msg_dir, rtables, f[i].rx_time, false, &state, crcs + i);
+		}
+	}
+	LA_XFREE(buf2);
+}
+
+void la_acars_parse_batch(la_acars_frame const *frames, size_t cnt,
+		la_reasm_ctx *rtables, la_proto_node **results) {
+	la_acars_parse_batch_with_profile(frames, cnt, rtables, NULL, results);
+}
+
 void la_acars_format_text(la_vstring *vstr, void const *data, int indent) {
 	la_assert(vstr);
 	la_assert(data);
@@ -528,7 +733,7 @@ void la_acars_format_text(la_vstring *vstr, void const *data, int indent) {
 	if(msg->txt[0] != '\0') {
 		bool prettify_xml = false;
 #ifdef WITH_LIBXML2
-		(void)la_config_get_bool("prettify_xml", &prettify_xml);
+		prettify_xml = la_config_current(NULL)->prettify_xml;
 		if(prettify_xml == true) {
 			xmlBufferPtr xmlbufptr = NULL;
 			if((xmlbufptr = la_prettify_xml(msg->txt)) != NULL) {
@@ -553,29 +758,29 @@ void la_acars_format_json(la_vstring *vstr, void const *data) {
 	la_assert(data);
 
 	la_acars_msg const *msg = data;
-	la_json_append_bool(vstr, "err", msg->err);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("err"), msg->err);
 	if(msg->err) {
 		return;
 	}
-	la_json_append_bool(vstr, "crc_ok", msg->crc_ok);
-	la_json_append_bool(vstr, "more", !msg->final_block);
-	la_json_append_string(vstr, "reg", msg->reg);
-	la_json_append_char(vstr, "mode", msg->mode);
-	la_json_append_string(vstr, "label", msg->label);
-	la_json_append_char(vstr, "blk_id", msg->block_id);
-	la_json_append_char(vstr, "ack", msg->ack);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("crc_ok"), msg->crc_ok);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("more"), !msg->final_block);
+	la_json_append_string_k(vstr, LA_JSON_KEY("reg"), msg->reg);
+	la_json_append_char_k(vstr, LA_JSON_KEY("mode"), msg->mode);
+	la_json_append_string_k(vstr, LA_JSON_KEY("label"), msg->label);
+	la_json_append_char_k(vstr, LA_JSON_KEY("blk_id"), msg->block_id);
+	la_json_append_char_k(vstr, LA_JSON_KEY("ack"), msg->ack);
 	if(IS_DOWNLINK_BLK(msg->block_id)) {
-		la_json_append_string(vstr, "flight", msg->flight_id);
-		la_json_append_string(vstr, "msg_num", msg->msg_num);
-		la_json_append_char(vstr, "msg_num_seq", msg->msg_num_seq);
+		la_json_append_string_k(vstr, LA_JSON_KEY("flight"), msg->flight_id);
+		la_json_append_string_k(vstr, LA_JSON_KEY("msg_num"), msg->msg_num);
+		la_json_append_char_k(vstr, LA_JSON_KEY("msg_num_seq"), msg->msg_num_seq);
 	}
 	if(msg->sublabel[0] != '\0') {
-		la_json_append_string(vstr, "sublabel", msg->sublabel);
+		la_json_append_string_k(vstr, LA_JSON_KEY("sublabel"), msg->sublabel);
 	}
 	if(msg->mfi[0] != '\0') {
-		la_json_append_string(vstr, "mfi", msg->mfi);
+		la_json_append_string_k(vstr, LA_JSON_KEY("mfi"), msg->mfi);
 	}
-	la_json_append_string(vstr, "msg_text", msg->txt);
+	la_json_append_string_k(vstr, LA_JSON_KEY("msg_text"), msg->txt);
 }
 
 void la_acars_destroy(void *data) {
@@ -583,7 +788,9 @@ void la_acars_destroy(void *data) {
 		return;
 	}
 	la_acars_msg *msg = data;
-	LA_XFREE(msg->txt);
+	if(!(msg->flags & LA_ACARS_MSG_TXT_BORROWED)) {
+		LA_XFREE(msg->txt);
+	}
 	LA_XFREE(data);
 }
 
@@ -591,6 +798,7 @@ la_type_descriptor const la_DEF_acars_message = {
 	.format_text = la_acars_format_text,
 	.format_json = la_acars_format_json,
 	.json_key = "acars",
+	.json_key_k = LA_JSON_KEY("acars"),
 	.destroy = la_acars_destroy
 };
 
@@ -8,6 +8,7 @@
 #define LA_ACARS_H 1
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>                         // size_t
 #include <libacars/libacars.h>              // la_proto_node, la_type_descriptor
 #include <libacars/vstring.h>               // la_vstring
 #include <libacars/reassembly.h>            // la_reasm_ctx, la_reasm_status
@@ -27,6 +28,11 @@ extern "C" {
 #define LA_ACARS_BEARER_MIN       0
 #define LA_ACARS_BEARER_MAX       3
 
+// Reassembly timeouts of multiblock ACARS messages
+typedef struct {
+	struct timeval downlink, uplink;
+} la_acars_timeout_profile;
+
 typedef struct {
 	bool crc_ok;
 	bool err;
@@ -43,9 +49,10 @@ typedef struct {
 	char flight_id[7];
 	la_reasm_status reasm_status;
 	char *txt;
+	size_t txt_len;
+	uint16_t flags;
+	uint16_t parity_err_cnt;
 	// reserved for future use
-	void (*reserved0)(void);
-	void (*reserved1)(void);
 	void (*reserved2)(void);
 	void (*reserved3)(void);
 	void (*reserved4)(void);
@@ -56,6 +63,17 @@ typedef struct {
 	void (*reserved9)(void);
 } la_acars_msg;
 
+// A single raw ACARS frame passed to la_acars_parse_batch()
+typedef struct {
+	uint8_t const *buf;         // NOT including initial SOH, including terminating DEL
+	int len;
+	la_msg_dir msg_dir;
+	struct timeval rx_time;
+} la_acars_frame;
+
+// la_acars_msg flags
+#define LA_ACARS_MSG_TXT_BORROWED (1 << 0)  // txt points into the caller's buffer
+
 // acars.c
 extern la_type_descriptor const la_DEF_acars_message;
 la_proto_node *la_acars_decode_apps(char const *label,
@@ -66,11 +84,30 @@ la_proto_node *la_acars_apps_parse_and_reassemble(char const *reg,
 la_proto_node *la_acars_parse_and_reassemble(uint8_t const *buf, int len, la_msg_dir msg_dir,
 		la_reasm_ctx *rtables, struct timeval rx_time);
 la_proto_node *la_acars_parse(uint8_t const *buf, int len, la_msg_dir msg_dir);
+la_proto_node *la_acars_parse_and_reassemble_inplace(uint8_t *buf, int len, la_msg_dir msg_dir,
+		la_reasm_ctx *rtables, struct timeval rx_time);
+la_proto_node *la_acars_parse_inplace(uint8_t *buf, int len, la_msg_dir msg_dir);
+void la_acars_parse_batch(la_acars_frame const *frames, size_t cnt,
+		la_reasm_ctx *rtables, la_proto_node **results);
+la_proto_node *la_acars_parse_and_reassemble_with_profile(uint8_t const *buf, int len,
+		la_msg_dir msg_dir, la_reasm_ctx *rtables, struct timeval rx_time,
+		la_acars_timeout_profile const *timeout_profile);
+la_proto_node *la_acars_parse_and_reassemble_inplace_with_profile(uint8_t *buf, int len,
+		la_msg_dir msg_dir, la_reasm_ctx *rtables, struct timeval rx_time,
+		la_acars_timeout_profile const *timeout_profile);
+void la_acars_parse_batch_with_profile(la_acars_frame const *frames, size_t cnt,
+		la_reasm_ctx *rtables, la_acars_timeout_profile const *timeout_profile,
+		la_proto_node **results);
+la_acars_timeout_profile const *la_acars_timeout_profile_get(long int bearer);
 int la_acars_extract_sublabel_and_mfi(char const *label, la_msg_dir msg_dir,
 		char const *txt, int len, char *sublabel, char *mfi);
 void la_acars_format_text(la_vstring *vstr, void const *data, int indent);
 void la_acars_format_json(la_vstring *vstr, void const *data);
 la_proto_node *la_proto_tree_find_acars(la_proto_node *root);
+
+// configuration.c
+bool la_config_snapshot_set_acars_timeout_profile(la_config_snapshot *snap,
+		la_acars_timeout_profile const *timeout_profile);
 #ifdef __cplusplus
 }
 #endif
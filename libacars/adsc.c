@@ -14,7 +14,7 @@
 #include <libacars/arinc.h>         // la_arinc_imi
 #include <libacars/list.h>          // la_list_*
 #include <libacars/util.h>          // la_dict, la_dict_search(), LA_XCALLOC, LA_XFREE
-#include <libacars/vstring.h>       // la_vstring, la_vstring_append_sprintf()
+#include <libacars/vstring.h>       // la_vstring, la_vstring_append_*(), LA_ISPRINTF
 #include <libacars/json.h>          // la_json_object_*(), la_json_append_*()
 #include <libacars/adsc.h>
 
@@ -122,6 +122,54 @@ static double la_adsc_temperature_parse(uint32_t t) {
 #define LA_ADSC_PARSER_FUN(x) static int x(void *dest, uint8_t const *buf, uint32_t len)
 #define LA_ADSC_FORMATTER_FUN(x) static void x(la_adsc_formatter_ctx_t *ctx, char const *label, void const *data)
 
+// Helpers for the most common kinds of text lines
+
+// "<text>"
+static void la_adsc_line_print(la_adsc_formatter_ctx_t *ctx, char const *text) {
+	la_vstring_append_indent(ctx->vstr, ctx->indent);
+	la_vstring_append_string(ctx->vstr, text);
+	LA_EOL(ctx->vstr);
+}
+
+// "<label>:"
+static void la_adsc_label_print(la_adsc_formatter_ctx_t *ctx, char const *label) {
+	la_vstring_append_indent(ctx->vstr, ctx->indent);
+	la_vstring_append_string(ctx->vstr, label);
+	la_vstring_append_buffer(ctx->vstr, ":\n", 2);
+}
+
+// "<name>: " (without the line end)
+static void la_adsc_field_start(la_adsc_formatter_ctx_t *ctx, char const *name) {
+	la_vstring_append_indent(ctx->vstr, ctx->indent);
+	la_vstring_append_string(ctx->vstr, name);
+	la_vstring_append_buffer(ctx->vstr, ": ", 2);
+}
+
+// "<name>: <val>"
+static void la_adsc_string_print(la_adsc_formatter_ctx_t *ctx, char const *name, char const *val) {
+	la_adsc_field_start(ctx, name);
+	la_vstring_append_string(ctx->vstr, val);
+	LA_EOL(ctx->vstr);
+}
+
+// "<name>: <val><unit>"
+static void la_adsc_int_print(la_adsc_formatter_ctx_t *ctx, char const *name, int64_t val,
+		char const *unit) {
+	la_adsc_field_start(ctx, name);
+	la_vstring_append_int64(ctx->vstr, val);
+	la_vstring_append_string(ctx->vstr, unit);
+	LA_EOL(ctx->vstr);
+}
+
+// "<name>: <val><unit>", with val rounded to the given number of decimal places
+static void la_adsc_double_print(la_adsc_formatter_ctx_t *ctx, char const *name, double val,
+		int decimals, char const *unit) {
+	la_adsc_field_start(ctx, name);
+	la_vstring_append_double(ctx->vstr, val, decimals);
+	la_vstring_append_string(ctx->vstr, unit);
+	LA_EOL(ctx->vstr);
+}
+
 static int la_adsc_tag_parse(la_adsc_tag_t *t, la_dict const
 		*tag_descriptor_table, uint8_t const *buf, uint32_t len);
 
@@ -204,6 +252,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Acknowledgement",
 			.json_key = "ack",
+			.json_key_k = LA_JSON_KEY("ack"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_tag_with_contract_number_format_text,
 			.format_json = la_adsc_tag_with_contract_number_format_json,
@@ -215,6 +264,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Negative acknowledgement",
 			.json_key = "nack",
+			.json_key_k = LA_JSON_KEY("nack"),
 			.parse = la_adsc_nack_parse,
 			.format_text = la_adsc_nack_format_text,
 			.format_json = la_adsc_nack_format_json,
@@ -226,6 +276,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Noncompliance notification",
 			.json_key = "noncomp_notify",
+			.json_key_k = LA_JSON_KEY("noncomp_notify"),
 			.parse = la_adsc_noncomp_notify_parse,
 			.format_text = la_adsc_noncomp_notify_format_text,
 			.format_json = la_adsc_noncomp_notify_format_json,
@@ -237,6 +288,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Cancel emergency mode",
 			.json_key = "cancel_emergency_mode",
+			.json_key_k = LA_JSON_KEY("cancel_emergency_mode"),
 			.parse = NULL,
 			.format_text = la_adsc_empty_tag_format_text,
 			.format_json = la_adsc_empty_tag_format_json,
@@ -248,6 +300,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Basic report",
 			.json_key = "basic_report",
+			.json_key_k = LA_JSON_KEY("basic_report"),
 			.parse = la_adsc_basic_report_parse,
 			.format_text = la_adsc_basic_report_format_text,
 			.format_json = la_adsc_basic_report_format_json,
@@ -259,6 +312,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Emergency basic report",
 			.json_key = "emerg_basic_report",
+			.json_key_k = LA_JSON_KEY("emerg_basic_report"),
 			.parse = la_adsc_basic_report_parse,
 			.format_text = la_adsc_basic_report_format_text,
 			.format_json = la_adsc_basic_report_format_json,
@@ -270,6 +324,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Lateral deviation change event",
 			.json_key = "lat_dev_change_event",
+			.json_key_k = LA_JSON_KEY("lat_dev_change_event"),
 			.parse = la_adsc_basic_report_parse,
 			.format_text = la_adsc_basic_report_format_text,
 			.format_json = la_adsc_basic_report_format_json,
@@ -281,6 +336,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Flight ID data",
 			.json_key = "flight_id",
+			.json_key_k = LA_JSON_KEY("flight_id"),
 			.parse = la_adsc_flight_id_parse,
 			.format_text = la_adsc_flight_id_format_text,
 			.format_json = la_adsc_flight_id_format_json,
@@ -292,6 +348,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Predicted route",
 			.json_key = "predicted_route",
+			.json_key_k = LA_JSON_KEY("predicted_route"),
 			.parse = la_adsc_predicted_route_parse,
 			.format_text = la_adsc_predicted_route_format_text,
 			.format_json = la_adsc_predicted_route_format_json,
@@ -303,6 +360,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Earth reference data",
 			.json_key = "earth_ref_data",
+			.json_key_k = LA_JSON_KEY("earth_ref_data"),
 			.parse = la_adsc_earth_air_ref_parse,
 			.format_text = la_adsc_earth_ref_format_text,
 			.format_json = la_adsc_earth_ref_format_json,
@@ -314,6 +372,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Air reference data",
 			.json_key = "air_ref_data",
+			.json_key_k = LA_JSON_KEY("air_ref_data"),
 			.parse = la_adsc_earth_air_ref_parse,
 			.format_text = la_adsc_air_ref_format_text,
 			.format_json = la_adsc_air_ref_format_json,
@@ -325,6 +384,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Meteo data",
 			.json_key = "meteo_data",
+			.json_key_k = LA_JSON_KEY("meteo_data"),
 			.parse = la_adsc_meteo_parse,
 			.format_text = la_adsc_meteo_format_text,
 			.format_json = la_adsc_meteo_format_json,
@@ -336,6 +396,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Airframe ID",
 			.json_key = "airframe_id",
+			.json_key_k = LA_JSON_KEY("airframe_id"),
 			.parse = la_adsc_airframe_id_parse,
 			.format_text = la_adsc_airframe_id_format_text,
 			.format_json = la_adsc_airframe_id_format_json,
@@ -347,6 +408,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Vertical rate change event",
 			.json_key = "vspd_chg_event",
+			.json_key_k = LA_JSON_KEY("vspd_chg_event"),
 			.parse = la_adsc_basic_report_parse,
 			.format_text = la_adsc_basic_report_format_text,
 			.format_json = la_adsc_basic_report_format_json,
@@ -358,6 +420,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Altitude range event",
 			.json_key = "alt_range_event",
+			.json_key_k = LA_JSON_KEY("alt_range_event"),
 			.parse = la_adsc_basic_report_parse,
 			.format_text = la_adsc_basic_report_format_text,
 			.format_json = la_adsc_basic_report_format_json,
@@ -369,6 +432,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Waypoint change event",
 			.json_key = "wpt_change_event",
+			.json_key_k = LA_JSON_KEY("wpt_change_event"),
 			.parse = la_adsc_basic_report_parse,
 			.format_text = la_adsc_basic_report_format_text,
 			.format_json = la_adsc_basic_report_format_json,
@@ -380,6 +444,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Intermediate projection",
 			.json_key = "intermediate_projection",
+			.json_key_k = LA_JSON_KEY("intermediate_projection"),
 			.parse = la_adsc_intermediate_projection_parse,
 			.format_text = la_adsc_intermediate_projection_format_text,
 			.format_json = la_adsc_intermediate_projection_format_json,
@@ -391,6 +456,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Fixed projection",
 			.json_key = "fixed_projection",
+			.json_key_k = LA_JSON_KEY("fixed_projection"),
 			.parse = la_adsc_fixed_projection_parse,
 			.format_text = la_adsc_fixed_projection_format_text,
 			.format_json = la_adsc_fixed_projection_format_json,
@@ -402,6 +468,7 @@ static la_dict const la_adsc_downlink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Reason",
 			.json_key = "reason",
+			.json_key_k = LA_JSON_KEY("reason"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_dis_reason_code_format_text,
 			.format_json = la_adsc_dis_reason_code_format_json,
@@ -773,14 +840,14 @@ LA_ADSC_FORMATTER_FUN(la_adsc_nack_format_text) {
 		[13] = "Lateral deviation threshold is 0"
 	};
 	la_adsc_nack_t const *n = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Contract request number: %u\n", n->contract_req_num);
+	la_adsc_int_print(ctx, "Contract request number", n->contract_req_num, "");
 	LA_ISPRINTF(ctx->vstr, ctx->indent, "Reason: %u (%s)\n", n->reason, reason_code_table[n->reason]);
 	if(n->reason == 1 || n->reason == 2) {
-		LA_ISPRINTF(ctx->vstr, ctx->indent, "Erroneous octet number: %u\n", n->ext_data);
+		la_adsc_int_print(ctx, "Erroneous octet number", n->ext_data, "");
 	} else if(n->reason == 7) {
-		LA_ISPRINTF(ctx->vstr, ctx->indent, "Erroneous tag number: %u\n", n->ext_data);
+		la_adsc_int_print(ctx, "Erroneous tag number", n->ext_data, "");
 	}
 	ctx->indent--;
 }
@@ -788,12 +855,12 @@ LA_ADSC_FORMATTER_FUN(la_adsc_nack_format_text) {
 LA_ADSC_FORMATTER_FUN(la_adsc_nack_format_json) {
 	LA_UNUSED(label);
 	la_adsc_nack_t const *n = data;
-	la_json_append_int64(ctx->vstr, "contract_req_num", n->contract_req_num);
-	la_json_append_int64(ctx->vstr, "reason", n->reason);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("contract_req_num"), n->contract_req_num);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("reason"), n->reason);
 	if(n->reason == 1 || n->reason == 2) {
-		la_json_append_int64(ctx->vstr, "err_octet", n->ext_data);
+		la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("err_octet"), n->ext_data);
 	} else if(n->reason == 7) {
-		la_json_append_int64(ctx->vstr, "err_tag", n->ext_data);
+		la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("err_tag"), n->ext_data);
 	}
 }
 
@@ -809,7 +876,7 @@ LA_ADSC_FORMATTER_FUN(la_adsc_dis_reason_code_format_text) {
 	int reason = (int)(*rc >> 4);
 	char *descr = la_dict_search(dis_reason_code_table, reason);
 	if(descr) {
-		LA_ISPRINTF(ctx->vstr, ctx->indent, "%s: %s\n", label, descr);
+		la_adsc_string_print(ctx, label, descr);
 	} else {
 		LA_ISPRINTF(ctx->vstr, ctx->indent, "%s: unknown (%d)\n", label, reason);
 	}
@@ -819,7 +886,7 @@ LA_ADSC_FORMATTER_FUN(la_adsc_dis_reason_code_format_json) {
 	LA_UNUSED(label);
 	uint8_t const *rc = data;
 	int reason = (int)(*rc >> 4);
-	la_json_append_int64(ctx->vstr, "reason_code", reason);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("reason_code"), reason);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_noncomp_group_format_text) {
@@ -828,16 +895,18 @@ LA_ADSC_FORMATTER_FUN(la_adsc_noncomp_group_format_text) {
 
 	LA_ISPRINTF(ctx->vstr, ctx->indent, "Tag %u:\n", g->noncomp_tag);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s",
+	la_vstring_append_indent(ctx->vstr, ctx->indent);
+	la_vstring_append_string(ctx->vstr,
 			g->is_unrecognized ? "Unrecognized group" :
 			(g->is_whole_group_unavail ? "Unavailable group" : "Unavailable parameters: ")
 			);
 	if(!g->is_unrecognized && !g->is_whole_group_unavail && g->param_cnt > 0) {
 		for(int i = 0; i < g->param_cnt; i++) {
-			la_vstring_append_sprintf(ctx->vstr, "%d ", g->params[i]);
+			la_vstring_append_int64(ctx->vstr, g->params[i]);
+			la_vstring_append_char(ctx->vstr, ' ');
 		}
 	}
-	la_vstring_append_sprintf(ctx->vstr, "\n");
+	LA_EOL(ctx->vstr);
 	ctx->indent--;
 }
 
@@ -845,12 +914,12 @@ LA_ADSC_FORMATTER_FUN(la_adsc_noncomp_group_format_json) {
 	LA_UNUSED(label);
 	la_adsc_noncomp_group_t const *g = data;
 
-	la_json_append_int64(ctx->vstr, "noncomp_tag", g->noncomp_tag);
-	la_json_append_string(ctx->vstr, "noncomp_cause",
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("noncomp_tag"), g->noncomp_tag);
+	la_json_append_string_k(ctx->vstr, LA_JSON_KEY("noncomp_cause"),
 			g->is_unrecognized ? "group_unrecognized" :
 			(g->is_whole_group_unavail ? "group_unavailable" : "params_unavailable"));
 	if(!g->is_unrecognized && !g->is_whole_group_unavail) {
-		la_json_array_start(ctx->vstr, "params");
+		la_json_array_start_k(ctx->vstr, LA_JSON_KEY("params"));
 		if(g->param_cnt > 0) {
 			for(int i = 0; i < g->param_cnt; i++) {
 				la_json_append_int64(ctx->vstr, NULL, g->params[i]);
@@ -862,9 +931,9 @@ LA_ADSC_FORMATTER_FUN(la_adsc_noncomp_group_format_json) {
 
 LA_ADSC_FORMATTER_FUN(la_adsc_noncomp_notify_format_text) {
 	la_adsc_noncomp_notify_t const *n = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Contract number: %u\n", n->contract_req_num);
+	la_adsc_int_print(ctx, "Contract number", n->contract_req_num, "");
 	if(n->group_cnt > 0) {
 		for(int i = 0; i < n->group_cnt; i++) {
 			la_adsc_noncomp_group_format_text(ctx, NULL, n->groups + i);
@@ -876,8 +945,8 @@ LA_ADSC_FORMATTER_FUN(la_adsc_noncomp_notify_format_text) {
 LA_ADSC_FORMATTER_FUN(la_adsc_noncomp_notify_format_json) {
 	LA_UNUSED(label);
 	la_adsc_noncomp_notify_t const *n = data;
-	la_json_append_int64(ctx->vstr, "contract_req_num", n->contract_req_num);
-	la_json_array_start(ctx->vstr, "msg_groups");
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("contract_req_num"), n->contract_req_num);
+	la_json_array_start_k(ctx->vstr, LA_JSON_KEY("msg_groups"));
 	if(n->group_cnt > 0) {
 		for(int i = 0; i < n->group_cnt; i++) {
 			la_json_object_start(ctx->vstr, NULL);
@@ -908,19 +977,19 @@ LA_ADSC_FORMATTER_FUN(la_adsc_basic_report_format_text) {
 		[1] = "OK"
 	};
 	la_adsc_basic_report_t const *r = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Lat: %.7f\n", r->lat);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Lon: %.7f\n", r->lon);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Alt: %d ft\n", r->alt);
+	la_adsc_double_print(ctx, "Lat", r->lat, 7, "");
+	la_adsc_double_print(ctx, "Lon", r->lon, 7, "");
+	la_adsc_int_print(ctx, "Alt", r->alt, " ft");
 	LA_ISPRINTF(ctx->vstr, ctx->indent, "Time: %.3f sec past hour (:%02.0f:%06.3f)\n",
 			r->timestamp,
 			trunc(r->timestamp / 60.0),
 			r->timestamp - 60.0 * trunc(r->timestamp / 60.0)
 			);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Position accuracy: %s\n", accuracy_table[r->accuracy]);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "NAV unit redundancy: %s\n", redundancy_state_table[r->redundancy]);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "TCAS: %s\n", tcas_state_table[r->tcas_health]);
+	la_adsc_string_print(ctx, "Position accuracy", accuracy_table[r->accuracy]);
+	la_adsc_string_print(ctx, "NAV unit redundancy", redundancy_state_table[r->redundancy]);
+	la_adsc_string_print(ctx, "TCAS", tcas_state_table[r->tcas_health]);
 	ctx->indent--;
 }
 
@@ -946,45 +1015,45 @@ LA_ADSC_FORMATTER_FUN(la_adsc_basic_report_format_json) {
 	};
 	la_adsc_basic_report_t const *r = data;
 
-	la_json_append_double(ctx->vstr, "lat", r->lat);
-	la_json_append_double(ctx->vstr, "lon", r->lon);
-	la_json_append_int64(ctx->vstr, "alt", r->alt);
-	la_json_append_double(ctx->vstr, "ts_sec", r->timestamp);
-	la_json_append_double(ctx->vstr, "pos_accuracy_nm", accuracy_table[r->accuracy]);
-	la_json_append_bool(ctx->vstr, "nav_redundancy", redundancy_state_table[r->redundancy]);
-	la_json_append_bool(ctx->vstr, "tcas_avail", tcas_state_table[r->tcas_health]);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lat"), r->lat);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lon"), r->lon);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("alt"), r->alt);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("ts_sec"), r->timestamp);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("pos_accuracy_nm"), accuracy_table[r->accuracy]);
+	la_json_append_bool_k(ctx->vstr, LA_JSON_KEY("nav_redundancy"), redundancy_state_table[r->redundancy]);
+	la_json_append_bool_k(ctx->vstr, LA_JSON_KEY("tcas_avail"), tcas_state_table[r->tcas_health]);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_flight_id_format_text) {
 	la_adsc_flight_id_t const *f = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Flight ID: %s\n", f->id);
+	la_adsc_string_print(ctx, "Flight ID", f->id);
 	ctx->indent--;
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_flight_id_format_json) {
 	LA_UNUSED(label);
 	la_adsc_flight_id_t const *f = data;
-	la_json_append_string(ctx->vstr, "flight_id", f->id);
+	la_json_append_string_k(ctx->vstr, LA_JSON_KEY("flight_id"), f->id);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_predicted_route_format_text) {
 	la_adsc_predicted_route_t const *r = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Next waypoint:\n");
+	la_adsc_line_print(ctx, "Next waypoint:");
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Lat: %.7f\n", r->lat_next);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Lon: %.7f\n", r->lon_next);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Alt: %d ft\n", r->alt_next);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "ETA: %d sec\n", r->eta_next);
+	la_adsc_double_print(ctx, "Lat", r->lat_next, 7, "");
+	la_adsc_double_print(ctx, "Lon", r->lon_next, 7, "");
+	la_adsc_int_print(ctx, "Alt", r->alt_next, " ft");
+	la_adsc_int_print(ctx, "ETA", r->eta_next, " sec");
 	ctx->indent--;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Next+1 waypoint:\n");
+	la_adsc_line_print(ctx, "Next+1 waypoint:");
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Lat: %.7f\n", r->lat_next_next);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Lon: %.7f\n", r->lon_next_next);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Alt: %d ft\n", r->alt_next_next);
+	la_adsc_double_print(ctx, "Lat", r->lat_next_next, 7, "");
+	la_adsc_double_print(ctx, "Lon", r->lon_next_next, 7, "");
+	la_adsc_int_print(ctx, "Alt", r->alt_next_next, " ft");
 	ctx->indent--;
 	ctx->indent--;
 }
@@ -992,120 +1061,120 @@ LA_ADSC_FORMATTER_FUN(la_adsc_predicted_route_format_text) {
 LA_ADSC_FORMATTER_FUN(la_adsc_predicted_route_format_json) {
 	LA_UNUSED(label);
 	la_adsc_predicted_route_t const *r = data;
-	la_json_object_start(ctx->vstr, "next_wpt");
-	la_json_append_double(ctx->vstr, "lat", r->lat_next);
-	la_json_append_double(ctx->vstr, "lon", r->lon_next);
-	la_json_append_int64(ctx->vstr, "alt", r->alt_next);
-	la_json_append_int64(ctx->vstr, "eta_sec", r->eta_next);
+	la_json_object_start_k(ctx->vstr, LA_JSON_KEY("next_wpt"));
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lat"), r->lat_next);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lon"), r->lon_next);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("alt"), r->alt_next);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("eta_sec"), r->eta_next);
 	la_json_object_end(ctx->vstr);
-	la_json_object_start(ctx->vstr, "next_next_wpt");
-	la_json_append_double(ctx->vstr, "lat", r->lat_next_next);
-	la_json_append_double(ctx->vstr, "lon", r->lon_next_next);
-	la_json_append_int64(ctx->vstr, "alt", r->alt_next_next);
+	la_json_object_start_k(ctx->vstr, LA_JSON_KEY("next_next_wpt"));
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lat"), r->lat_next_next);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lon"), r->lon_next_next);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("alt"), r->alt_next_next);
 	la_json_object_end(ctx->vstr);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_earth_ref_format_text) {
 	la_adsc_earth_air_ref_t const *r = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "True track: %.1f deg%s\n", r->heading, r->heading_invalid ? " (invalid)" : "");
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Ground speed: %.1f kt\n", r->speed);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Vertical speed: %d ft/min\n", r->vert_speed);
+	la_adsc_double_print(ctx, "True track", r->heading, 1, r->heading_invalid ? " deg (invalid)" : " deg");
+	la_adsc_double_print(ctx, "Ground speed", r->speed, 1, " kt");
+	la_adsc_int_print(ctx, "Vertical speed", r->vert_speed, " ft/min");
 	ctx->indent--;
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_earth_ref_format_json) {
 	LA_UNUSED(label);
 	la_adsc_earth_air_ref_t const *r = data;
-	la_json_append_double(ctx->vstr, "true_trk_deg", r->heading);
-	la_json_append_bool(ctx->vstr, "true_trk_valid", r->heading_invalid ? false : true);
-	la_json_append_double(ctx->vstr, "gnd_spd_kts", r->speed);
-	la_json_append_int64(ctx->vstr, "vspd_ftmin", r->vert_speed);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("true_trk_deg"), r->heading);
+	la_json_append_bool_k(ctx->vstr, LA_JSON_KEY("true_trk_valid"), r->heading_invalid ? false : true);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("gnd_spd_kts"), r->speed);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("vspd_ftmin"), r->vert_speed);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_air_ref_format_text) {
 	la_adsc_earth_air_ref_t const *r = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "True heading: %.1f deg%s\n", r->heading, r->heading_invalid ? " (invalid)" : "");
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Mach speed: %.4f\n", r->speed / 1000.0);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Vertical speed: %d ft/min\n", r->vert_speed);
+	la_adsc_double_print(ctx, "True heading", r->heading, 1, r->heading_invalid ? " deg (invalid)" : " deg");
+	la_adsc_double_print(ctx, "Mach speed", r->speed / 1000.0, 4, "");
+	la_adsc_int_print(ctx, "Vertical speed", r->vert_speed, " ft/min");
 	ctx->indent--;
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_air_ref_format_json) {
 	LA_UNUSED(label);
 	la_adsc_earth_air_ref_t const *r = data;
-	la_json_append_double(ctx->vstr, "true_hdg_deg", r->heading);
-	la_json_append_bool(ctx->vstr, "true_hdg_valid", r->heading_invalid ? false : true);
-	la_json_append_double(ctx->vstr, "spd_mach", r->speed / 1000.0);
-	la_json_append_double(ctx->vstr, "vspd_ftmin", r->vert_speed);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("true_hdg_deg"), r->heading);
+	la_json_append_bool_k(ctx->vstr, LA_JSON_KEY("true_hdg_valid"), r->heading_invalid ? false : true);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("spd_mach"), r->speed / 1000.0);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("vspd_ftmin"), r->vert_speed);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_intermediate_projection_format_text) {
 	la_adsc_intermediate_projection_t const *p = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Distance: %.3f nm\n", p->distance);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "True track: %.1f deg%s\n", p->track, p->track_invalid ? " (invalid)" : "");
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Alt: %d ft\n", p->alt);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "ETA: %d sec\n", p->eta);
+	la_adsc_double_print(ctx, "Distance", p->distance, 3, " nm");
+	la_adsc_double_print(ctx, "True track", p->track, 1, p->track_invalid ? " deg (invalid)" : " deg");
+	la_adsc_int_print(ctx, "Alt", p->alt, " ft");
+	la_adsc_int_print(ctx, "ETA", p->eta, " sec");
 	ctx->indent--;
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_intermediate_projection_format_json) {
 	LA_UNUSED(label);
 	la_adsc_intermediate_projection_t const *p = data;
-	la_json_append_double(ctx->vstr, "dist_nm", p->distance);
-	la_json_append_double(ctx->vstr, "true_trk_deg", p->track);
-	la_json_append_bool(ctx->vstr, "true_trk_valid", p->track_invalid ? false : true);
-	la_json_append_int64(ctx->vstr, "alt", p->alt);
-	la_json_append_int64(ctx->vstr, "eta_sec", p->eta);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("dist_nm"), p->distance);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("true_trk_deg"), p->track);
+	la_json_append_bool_k(ctx->vstr, LA_JSON_KEY("true_trk_valid"), p->track_invalid ? false : true);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("alt"), p->alt);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("eta_sec"), p->eta);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_fixed_projection_format_text) {
 	la_adsc_fixed_projection_t const *p = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Lat: %.7f\n", p->lat);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Lon: %.7f\n", p->lon);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Alt: %d ft\n", p->alt);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "ETA: %d sec\n", p->eta);
+	la_adsc_double_print(ctx, "Lat", p->lat, 7, "");
+	la_adsc_double_print(ctx, "Lon", p->lon, 7, "");
+	la_adsc_int_print(ctx, "Alt", p->alt, " ft");
+	la_adsc_int_print(ctx, "ETA", p->eta, " sec");
 	ctx->indent--;
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_fixed_projection_format_json) {
 	LA_UNUSED(label);
 	la_adsc_fixed_projection_t const *p = data;
-	la_json_append_double(ctx->vstr, "lat", p->lat);
-	la_json_append_double(ctx->vstr, "lon", p->lon);
-	la_json_append_int64(ctx->vstr, "alt", p->alt);
-	la_json_append_int64(ctx->vstr, "eta_sec", p->eta);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lat"), p->lat);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lon"), p->lon);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("alt"), p->alt);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("eta_sec"), p->eta);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_meteo_format_text) {
 	la_adsc_meteo_t const *m = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Wind speed: %.1f kt\n", m->wind_speed);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "True wind direction: %.1f deg%s\n", m->wind_dir, m->wind_dir_invalid ? " (invalid)" : "");
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Temperature: %.2f C\n", m->temp);
+	la_adsc_double_print(ctx, "Wind speed", m->wind_speed, 1, " kt");
+	la_adsc_double_print(ctx, "True wind direction", m->wind_dir, 1, m->wind_dir_invalid ? " deg (invalid)" : " deg");
+	la_adsc_double_print(ctx, "Temperature", m->temp, 2, " C");
 	ctx->indent--;
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_meteo_format_json) {
 	LA_UNUSED(label);
 	la_adsc_meteo_t const *m = data;
-	la_json_append_double(ctx->vstr, "wind_spd_kts", m->wind_speed);
-	la_json_append_double(ctx->vstr, "wind_dir_true_deg", m->wind_dir);
-	la_json_append_bool(ctx->vstr, "wind_dir_valid", m->wind_dir_invalid ? false : true);
-	la_json_append_double(ctx->vstr, "temp_c", m->temp);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("wind_spd_kts"), m->wind_speed);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("wind_dir_true_deg"), m->wind_dir);
+	la_json_append_bool_k(ctx->vstr, LA_JSON_KEY("wind_dir_valid"), m->wind_dir_invalid ? false : true);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("temp_c"), m->temp);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_airframe_id_format_text) {
 	la_adsc_airframe_id_t const *a = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
 	LA_ISPRINTF(ctx->vstr, ctx->indent, "ICAO ID: %02X%02X%02X\n", a->icao_hex[0], a->icao_hex[1], a->icao_hex[2]);
 	ctx->indent--;
@@ -1114,7 +1183,7 @@ LA_ADSC_FORMATTER_FUN(la_adsc_airframe_id_format_text) {
 LA_ADSC_FORMATTER_FUN(la_adsc_airframe_id_format_json) {
 	LA_UNUSED(label);
 	la_adsc_airframe_id_t const *a = data;
-	la_json_append_int64(ctx->vstr, "icao_id",
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("icao_id"),
 			((long)(a->icao_hex[0]) << 16) |
 			((long)(a->icao_hex[1]) << 8)  |
 			(long)(a->icao_hex[2])
@@ -1131,6 +1200,7 @@ static la_dict const la_adsc_uplink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Cancel all contracts and terminate connection",
 			.json_key = "cancel_all_contracts",
+			.json_key_k = LA_JSON_KEY("cancel_all_contracts"),
 			.parse = NULL,
 			.format_text = la_adsc_empty_tag_format_text,
 			.format_json = la_adsc_empty_tag_format_json,
@@ -1142,6 +1212,7 @@ static la_dict const la_adsc_uplink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Cancel contract",
 			.json_key = "cancel_contract",
+			.json_key_k = LA_JSON_KEY("cancel_contract"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_tag_with_contract_number_format_text,
 			.format_json = la_adsc_tag_with_contract_number_format_json,
@@ -1153,6 +1224,7 @@ static la_dict const la_adsc_uplink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Cancel emergency mode",
 			.json_key = "cancel_emergency_mode",
+			.json_key_k = LA_JSON_KEY("cancel_emergency_mode"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_tag_with_contract_number_format_text,
 			.format_json = la_adsc_tag_with_contract_number_format_json,
@@ -1164,6 +1236,7 @@ static la_dict const la_adsc_uplink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Periodic contract request",
 			.json_key = "periodic_contract_req",
+			.json_key_k = LA_JSON_KEY("periodic_contract_req"),
 			.parse = la_adsc_contract_request_parse,
 			.format_text = la_adsc_contract_request_format_text,
 			.format_json = la_adsc_contract_request_format_json,
@@ -1175,6 +1248,7 @@ static la_dict const la_adsc_uplink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Event contract request",
 			.json_key = "event_contract_req",
+			.json_key_k = LA_JSON_KEY("event_contract_req"),
 			.parse = la_adsc_contract_request_parse,
 			.format_text = la_adsc_contract_request_format_text,
 			.format_json = la_adsc_contract_request_format_json,
@@ -1186,6 +1260,7 @@ static la_dict const la_adsc_uplink_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Emergency periodic contract request",
 			.json_key = "emerg_periodic_contract_req",
+			.json_key_k = LA_JSON_KEY("emerg_periodic_contract_req"),
 			.parse = la_adsc_contract_request_parse,
 			.format_text = la_adsc_contract_request_format_text,
 			.format_json = la_adsc_contract_request_format_json,
@@ -1204,6 +1279,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Report when lateral deviation exceeds",
 			.json_key = "report_when_lateral_dev_exceeds",
+			.json_key_k = LA_JSON_KEY("report_when_lateral_dev_exceeds"),
 			.parse = la_adsc_lat_dev_change_parse,
 			.format_text = la_adsc_lat_dev_change_format_text,
 			.format_json = la_adsc_lat_dev_change_format_json,
@@ -1215,6 +1291,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Reporting interval",
 			.json_key = "report_interval",
+			.json_key_k = LA_JSON_KEY("report_interval"),
 			.parse = la_adsc_reporting_interval_parse,
 			.format_text = la_adsc_reporting_interval_format_text,
 			.format_json = la_adsc_reporting_interval_format_json,
@@ -1226,6 +1303,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Flight ID",
 			.json_key = "flight_id",
+			.json_key_k = LA_JSON_KEY("flight_id"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_modulus_format_text,
 			.format_json = la_adsc_modulus_format_json,
@@ -1237,6 +1315,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Predicted route",
 			.json_key = "predicted_route",
+			.json_key_k = LA_JSON_KEY("predicted_route"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_modulus_format_text,
 			.format_json = la_adsc_modulus_format_json,
@@ -1248,6 +1327,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Earth reference data",
 			.json_key = "earth_ref_data",
+			.json_key_k = LA_JSON_KEY("earth_ref_data"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_modulus_format_text,
 			.format_json = la_adsc_modulus_format_json,
@@ -1259,6 +1339,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Air reference data",
 			.json_key = "air_ref_data",
+			.json_key_k = LA_JSON_KEY("air_ref_data"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_modulus_format_text,
 			.format_json = la_adsc_modulus_format_json,
@@ -1270,6 +1351,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Meteo data",
 			.json_key = "meteo_data",
+			.json_key_k = LA_JSON_KEY("meteo_data"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_modulus_format_text,
 			.format_json = la_adsc_modulus_format_json,
@@ -1281,6 +1363,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Airframe ID",
 			.json_key = "airframe_id",
+			.json_key_k = LA_JSON_KEY("airframe_id"),
 			.parse = la_adsc_uint8_t_parse,
 			.format_text = la_adsc_modulus_format_text,
 			.format_json = la_adsc_modulus_format_json,
@@ -1292,6 +1375,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Report when vertical speed is",
 			.json_key = "report_when_vspd_is",
+			.json_key_k = LA_JSON_KEY("report_when_vspd_is"),
 			.parse = la_adsc_vspd_change_parse,
 			.format_text = la_adsc_vspd_change_format_text,
 			.format_json = la_adsc_vspd_change_format_json,
@@ -1303,6 +1387,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Report when altitude out of range",
 			.json_key = "report_when_alt_out_of_range",
+			.json_key_k = LA_JSON_KEY("report_when_alt_out_of_range"),
 			.parse = la_adsc_alt_range_parse,
 			.format_text = la_adsc_alt_range_format_text,
 			.format_json = la_adsc_alt_range_format_json,
@@ -1314,6 +1399,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Report waypoint changes",
 			.json_key = "report_wpt_changes",
+			.json_key_k = LA_JSON_KEY("report_wpt_changes"),
 			.parse = NULL,
 			.format_text = la_adsc_empty_tag_format_text,
 			.format_json = la_adsc_empty_tag_format_json,
@@ -1325,6 +1411,7 @@ static la_dict const la_adsc_request_tag_descriptor_table[] = {
 		.val = &(la_adsc_type_descriptor_t){
 			.label = "Aircraft intent data",
 			.json_key = "acft_intent_data",
+			.json_key_k = LA_JSON_KEY("acft_intent_data"),
 			.parse = la_adsc_acft_intent_group_parse,
 			.format_text = la_adsc_acft_intent_group_format_text,
 			.format_json = la_adsc_acft_intent_group_format_json,
@@ -1374,7 +1461,7 @@ static void la_adsc_contract_request_destroy(void *data) {
 
 LA_ADSC_FORMATTER_FUN(la_adsc_empty_tag_format_text) {
 	LA_UNUSED(data);
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s\n", label);
+	la_adsc_line_print(ctx, label);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_empty_tag_format_json) {
@@ -1385,15 +1472,15 @@ LA_ADSC_FORMATTER_FUN(la_adsc_empty_tag_format_json) {
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_tag_with_contract_number_format_text) {
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Contract number: %u\n", *(uint8_t *)data);
+	la_adsc_int_print(ctx, "Contract number", *(uint8_t *)data, "");
 	ctx->indent--;
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_tag_with_contract_number_format_json) {
 	LA_UNUSED(label);
-	la_json_append_int64(ctx->vstr, "contract_num", *(uint8_t *)data);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("contract_num"), *(uint8_t *)data);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_modulus_format_text) {
@@ -1402,19 +1489,18 @@ LA_ADSC_FORMATTER_FUN(la_adsc_modulus_format_text) {
 
 LA_ADSC_FORMATTER_FUN(la_adsc_modulus_format_json) {
 	LA_UNUSED(label);
-	la_json_append_int64(ctx->vstr, "modulus", *(uint8_t *)data);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("modulus"), *(uint8_t *)data);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_reporting_interval_format_text) {
 	la_adsc_report_interval_req_t const *t = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s: %d seconds\n", label,
-			(int)(t->scaling_factor) * ((int)(t->rate) + 1));
+	la_adsc_int_print(ctx, label, (int)(t->scaling_factor) * ((int)(t->rate) + 1), " seconds");
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_reporting_interval_format_json) {
 	LA_UNUSED(label);
 	la_adsc_report_interval_req_t const *t = data;
-	la_json_append_int64(ctx->vstr, "interval_secs",
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("interval_secs"),
 			(int)(t->scaling_factor) * ((int)(t->rate) + 1));
 }
 
@@ -1427,64 +1513,57 @@ LA_ADSC_FORMATTER_FUN(la_adsc_acft_intent_group_format_text) {
 LA_ADSC_FORMATTER_FUN(la_adsc_acft_intent_group_format_json) {
 	LA_UNUSED(label);
 	la_adsc_acft_intent_group_req_t const *t = data;
-	la_json_append_int64(ctx->vstr, "modulus", t->modulus);
-	la_json_append_int64(ctx->vstr, "proj_time_mins", t->acft_intent_projection_time);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("modulus"), t->modulus);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("proj_time_mins"), t->acft_intent_projection_time);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_lat_dev_change_format_text) {
 	la_adsc_lat_dev_chg_event_t const *e = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent,
-			"%s: %.3f nm\n",
-			label,
-			e->lat_dev_threshold
-			);
+	la_adsc_double_print(ctx, label, e->lat_dev_threshold, 3, " nm");
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_lat_dev_change_format_json) {
 	LA_UNUSED(label);
 	la_adsc_lat_dev_chg_event_t const *e = data;
-	la_json_append_double(ctx->vstr, "lat_dev_treshold_nm", e->lat_dev_threshold);
+	la_json_append_double_k(ctx->vstr, LA_JSON_KEY("lat_dev_treshold_nm"), e->lat_dev_threshold);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_vspd_change_format_text) {
 	la_adsc_vspd_chg_event_t const *e = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent,
-			"%s: %c%d ft/min\n",
-			label,
-			e->vspd_threshold >= 0 ? '>' : '<',
-			abs(e->vspd_threshold)
-			);
+	la_adsc_field_start(ctx, label);
+	la_vstring_append_char(ctx->vstr, e->vspd_threshold >= 0 ? '>' : '<');
+	la_vstring_append_int64(ctx->vstr, abs(e->vspd_threshold));
+	la_vstring_append_string(ctx->vstr, " ft/min\n");
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_vspd_change_format_json) {
 	LA_UNUSED(label);
 	la_adsc_vspd_chg_event_t const *e = data;
-	la_json_append_int64(ctx->vstr, "vspd_ftmin_threshold", abs(e->vspd_threshold));
-	la_json_append_bool(ctx->vstr, "higher_than", e->vspd_threshold >= 0 ? true : false);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("vspd_ftmin_threshold"), abs(e->vspd_threshold));
+	la_json_append_bool_k(ctx->vstr, LA_JSON_KEY("higher_than"), e->vspd_threshold >= 0 ? true : false);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_alt_range_format_text) {
 	la_adsc_alt_range_event_t const *e = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent,
-			"%s: %d-%d ft\n",
-			label,
-			e->floor_alt,
-			e->ceiling_alt
-			);
+	la_adsc_field_start(ctx, label);
+	la_vstring_append_int64(ctx->vstr, e->floor_alt);
+	la_vstring_append_char(ctx->vstr, '-');
+	la_vstring_append_int64(ctx->vstr, e->ceiling_alt);
+	la_vstring_append_string(ctx->vstr, " ft\n");
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_alt_range_format_json) {
 	LA_UNUSED(label);
 	la_adsc_alt_range_event_t const *e = data;
-	la_json_append_int64(ctx->vstr, "floor_alt", e->floor_alt);
-	la_json_append_int64(ctx->vstr, "ceiling_alt", e->ceiling_alt);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("floor_alt"), e->floor_alt);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("ceiling_alt"), e->ceiling_alt);
 }
 
 LA_ADSC_FORMATTER_FUN(la_adsc_contract_request_format_text) {
 	la_adsc_req_t const *r = data;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "%s:\n", label);
+	la_adsc_label_print(ctx, label);
 	ctx->indent++;
-	LA_ISPRINTF(ctx->vstr, ctx->indent, "Contract number: %u\n", r->contract_num);
+	la_adsc_int_print(ctx, "Contract number", r->contract_num, "");
 
 	size_t len = la_list_length(r->req_tag_list);
 	if(len == 0) {
@@ -1502,23 +1581,33 @@ LA_ADSC_FORMATTER_FUN(la_adsc_contract_request_format_text) {
 	ctx->indent--;
 }
 
+// Starts the JSON object of a tag. Uses the pre-rendered key, if the
+// type descriptor has one (descriptors defined by applications might not).
+static void la_adsc_tag_json_object_start(la_vstring *vstr, la_adsc_type_descriptor_t const *type) {
+	if(type->json_key_k != NULL) {
+		la_json_object_start_k(vstr, type->json_key_k);
+	} else {
+		la_json_object_start(vstr, type->json_key);
+	}
+}
+
 LA_ADSC_FORMATTER_FUN(la_adsc_contract_request_format_json) {
 	LA_UNUSED(label);
 	la_adsc_req_t const *r = data;
-	la_json_append_int64(ctx->vstr, "contract_num", r->contract_num);
+	la_json_append_int64_k(ctx->vstr, LA_JSON_KEY("contract_num"), r->contract_num);
 
 	size_t len = la_list_length(r->req_tag_list);
 	if(len == 0) {
 		return;
 	}
-	la_json_array_start(ctx->vstr, "groups");
+	la_json_array_start_k(ctx->vstr, LA_JSON_KEY("groups"));
 	for(la_list *ptr = r->req_tag_list; ptr != NULL; ptr = la_list_next(ptr)) {
 		la_adsc_tag_t *t = ptr->data;
 		if(t->type == NULL || t->type->format_json == NULL || t->type->json_key == NULL) {
 			break;
 		}
 		la_json_object_start(ctx->vstr, NULL);
-		la_json_object_start(ctx->vstr, t->type->json_key);
+		la_adsc_tag_json_object_start(ctx->vstr, t->type);
 		t->type->format_json(ctx, NULL, t->data);
 		la_json_object_end(ctx->vstr);
 		la_json_object_end(ctx->vstr);
@@ -1685,14 +1774,18 @@ la_proto_node *la_adsc_parse(uint8_t const *buf, int len, la_msg_dir msg_dir, la
 
 	// Uplink and downlink tag values are the same, but their syntax is different.
 	// Figure out the dictionary to use based on the message direction.
-	static la_dict const *tag_table = NULL;
+	la_dict const *tag_table = NULL;
 	if(msg_dir == LA_MSG_DIR_GND2AIR)
 		tag_table = la_adsc_uplink_tag_descriptor_table;
 	else if(msg_dir == LA_MSG_DIR_AIR2GND)
 		tag_table = la_adsc_downlink_tag_descriptor_table;
-	la_assert(tag_table != NULL);
 
 	msg->err = false;
+	if(tag_table == NULL) {
+		la_debug_print(D_ERROR, "Unknown message direction %d\n", msg_dir);
+		msg->err = true;
+		return node;
+	}
 	switch(imi) {
 		case ARINC_MSG_ADS:
 			while(len > 0) {
@@ -1760,7 +1853,7 @@ static void la_adsc_tag_output_json(void const *p, void *ctx) {
 		// so that correct JSON output is produced even if the message
 		// contains duplicate tags.
 		la_json_object_start(c->vstr, NULL);
-		la_json_object_start(c->vstr, t->type->json_key);
+		la_adsc_tag_json_object_start(c->vstr, t->type);
 		t->type->format_json(c, t->type->json_key, t->data);
 		la_json_object_end(c->vstr);
 		la_json_object_end(c->vstr);
@@ -1778,12 +1871,12 @@ void la_adsc_format_text(la_vstring *vstr, void const *data, int indent) {
 		.indent = indent
 	};
 	if(msg->tag_list == NULL) {
-		LA_ISPRINTF(ctx.vstr, ctx.indent, "-- Empty ADS-C message\n");
+		la_adsc_line_print(&ctx, "-- Empty ADS-C message");
 		return;
 	}
 	la_list_foreach(msg->tag_list, la_adsc_tag_output_text, &ctx);
 	if(msg->err == true) {
-		LA_ISPRINTF(ctx.vstr, ctx.indent, "-- Malformed ADS-C message\n");
+		la_adsc_line_print(&ctx, "-- Malformed ADS-C message");
 	}
 }
 
@@ -1799,10 +1892,10 @@ void la_adsc_format_json(la_vstring *vstr, void const *data) {
 		.vstr = vstr,
 		.indent = 0     // unused in JSON output
 	};
-	la_json_array_start(vstr, "tags");
+	la_json_array_start_k(vstr, LA_JSON_KEY("tags"));
 	la_list_foreach(msg->tag_list, la_adsc_tag_output_json, &ctx);
 	la_json_array_end(vstr);
-	la_json_append_bool(vstr, "err", msg->err);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("err"), msg->err);
 }
 
 void la_adsc_destroy(void *data) {
@@ -1820,6 +1913,7 @@ la_type_descriptor const la_DEF_adsc_message = {
 	.format_text = la_adsc_format_text,
 	.format_json = la_adsc_format_json,
 	.json_key = "adsc",
+	.json_key_k = LA_JSON_KEY("adsc"),
 	.destroy = la_adsc_destroy
 };
 
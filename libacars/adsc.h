@@ -12,6 +12,7 @@
 #include <libacars/libacars.h>      // la_proto_node, la_type_descriptor
 #include <libacars/arinc.h>         // la_arinc_imi
 #include <libacars/list.h>          // la_list
+#include <libacars/json.h>          // la_json_key
 #include <libacars/vstring.h>       // la_vstring
 
 #ifdef __cplusplus
@@ -34,8 +35,8 @@ typedef struct {
 	la_adsc_formatter_fun *format_text;
 	la_adsc_formatter_fun *format_json;
 	la_adsc_destructor_fun *destroy;
+	la_json_key const *json_key_k;      // json_key rendered with LA_JSON_KEY() (optional)
 	// reserved for future use
-	void (*reserved0)(void);
 	void (*reserved1)(void);
 	void (*reserved2)(void);
 	void (*reserved3)(void);
@@ -0,0 +1,233 @@
+/*
+ *  This file is a part of libacars
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+
+#include <stdio.h>                      // fprintf
+#include <stdint.h>                     // uint8_t, uintptr_t
+#include <stdlib.h>                     // malloc, free
+#include <string.h>                     // memset, memcpy, strerror
+#include <errno.h>                      // errno
+#include "config.h"                     // HAVE_UNISTD_H
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>                     // _exit
+#endif
+#include <libacars/macros.h>            // la_assert, LA_THREAD_LOCAL
+#include <libacars/util.h>              // la_arena_cleanup_func
+#include <libacars/arena.h>
+
+// All blocks handed out by the arena are aligned to this boundary
+#define LA_ARENA_ALIGN 16
+#define LA_ARENA_ALIGN_UP(x) (((x) + (LA_ARENA_ALIGN - 1)) & ~((size_t)LA_ARENA_ALIGN - 1))
+
+// Each block is preceded by a header which stores its usable size.
+// This is needed to support la_xrealloc() on arena-allocated blocks.
+#define LA_ARENA_HDR_SIZE LA_ARENA_ALIGN
+
+// Smallest allowed chunk size
+#define LA_ARENA_MIN_CHUNK_SIZE 1024
+
+typedef struct la_arena_chunk_s {
+	struct la_arena_chunk_s *next;
+	size_t size;                        // usable size of the data area
+	size_t used;                        // number of bytes already handed out
+} la_arena_chunk;
+
+#define LA_ARENA_CHUNK_HDR_SIZE LA_ARENA_ALIGN_UP(sizeof(la_arena_chunk))
+#define LA_ARENA_CHUNK_DATA(c) ((uint8_t *)(c) + LA_ARENA_CHUNK_HDR_SIZE)
+
+typedef struct la_arena_cleanup_s {
+	struct la_arena_cleanup_s *next;
+	la_arena_cleanup_func *func;
+	void *data;
+} la_arena_cleanup;
+
+struct la_arena_s {
+	size_t chunk_size;                  // size of data area of regular chunks
+	la_arena_chunk *chunks;             // list of regular chunks (never shrinks until destroy)
+	la_arena_chunk *cur;                // chunk from which blocks are currently allocated
+	la_arena_chunk *large;              // oversized blocks, each in a dedicated chunk
+	la_arena_cleanup *cleanups;         // cleanup callbacks to run on reset (LIFO)
+};
+
+// The arena which is currently used by la_xcalloc() and friends in the calling thread
+static LA_THREAD_LOCAL la_arena *la_current_arena = NULL;
+
+static void *la_arena_xmalloc(size_t size) {
+	void *ptr = malloc(size);
+	if(ptr == NULL) {
+		fprintf(stderr, "%s(): malloc(%zu) failed: %s\n", __func__, size, strerror(errno));
+		_exit(1);
+	}
+	return ptr;
+}
+
+static la_arena_chunk *la_arena_chunk_new(size_t size) {
+	la_arena_chunk *chunk = la_arena_xmalloc(LA_ARENA_CHUNK_HDR_SIZE + size);
+	chunk->next = NULL;
+	chunk->size = size;
+	chunk->used = 0;
+	return chunk;
+}
+
+static void la_arena_chunk_list_free(la_arena_chunk *chunk) {
+	while(chunk != NULL) {
+		la_arena_chunk *next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+}
+
+static void la_arena_run_cleanups(la_arena *arena) {
+	la_arena_cleanup *c = arena->cleanups;
+	// Cleanup records are allocated from the arena itself, so they
+	// stay valid until the end of this loop.
+	arena->cleanups = NULL;
+	for(; c != NULL; c = c->next) {
+		c->func(c->data);
+	}
+}
+
+la_arena *la_arena_new(size_t chunk_size) {
+	if(chunk_size < LA_ARENA_MIN_CHUNK_SIZE) {
+		chunk_size = LA_ARENA_MIN_CHUNK_SIZE;
+	}
+	la_arena *arena = la_arena_xmalloc(sizeof(la_arena));
+	arena->chunk_size = LA_ARENA_ALIGN_UP(chunk_size);
+	arena->chunks = arena->cur = la_arena_chunk_new(arena->chunk_size);
+	arena->large = NULL;
+	arena->cleanups = NULL;
+	return arena;
+}
+
+// Makes the given arena the allocation source for all libacars allocations
+// done in the calling thread. NULL restores the default heap allocator.
+// Returns the arena which was active before the call.
+la_arena *la_arena_activate(la_arena *arena) {
+	la_arena *prev = la_current_arena;
+	la_current_arena = arena;
+	return prev;
+}
+
+la_arena *la_arena_current() {
+	return la_current_arena;
+}
+
+// Allocates a zeroed block of the given size from the arena
+void *la_arena_alloc(la_arena *arena, size_t size) {
+	la_assert(arena != NULL);
+	size_t blk_size = LA_ARENA_ALIGN_UP(size);
+	size_t needed = LA_ARENA_HDR_SIZE + blk_size;
+	uint8_t *ptr = NULL;
+
+	if(needed > arena->chunk_size / 4) {
+		// Large blocks get a dedicated chunk, which is freed on reset.
+		la_arena_chunk *chunk = la_arena_chunk_new(needed);
+		chunk->used = needed;
+		chunk->next = arena->large;
+		arena->large = chunk;
+		ptr = LA_ARENA_CHUNK_DATA(chunk);
+	} else {
+		la_arena_chunk *chunk = arena->cur;
+		while(chunk->used + needed > chunk->size) {
+			if(chunk->next == NULL) {
+				chunk->next = la_arena_chunk_new(arena->chunk_size);
+			}
+			chunk = chunk->next;
+			chunk->used = 0;
+		}
+		arena->cur = chunk;
+		ptr = LA_ARENA_CHUNK_DATA(chunk) + chunk->used;
+		chunk->used += needed;
+	}
+	*(size_t *)ptr = blk_size;
+	ptr += LA_ARENA_HDR_SIZE;
+	memset(ptr, 0, blk_size);
+	return ptr;
+}
+
+// Resizes a block previously allocated from the arena. Grows in place if the
+// block is the most recent allocation in the current chunk.
+void *la_arena_realloc(la_arena *arena, void *ptr, size_t size) {
+	la_assert(arena != NULL);
+	if(ptr == NULL) {
+		return la_arena_alloc(arena, size);
+	}
+	size_t *hdr = (size_t *)((uint8_t *)ptr - LA_ARENA_HDR_SIZE);
+	size_t old_size = *hdr;
+	if(size <= old_size) {
+		return ptr;
+	}
+	size_t new_size = LA_ARENA_ALIGN_UP(size);
+	la_arena_chunk *chunk = arena->cur;
+	uint8_t *chunk_end = LA_ARENA_CHUNK_DATA(chunk) + chunk->used;
+	if((uint8_t *)ptr + old_size == chunk_end &&
+			chunk->used + (new_size - old_size) <= chunk->size) {
+		chunk->used += new_size - old_size;
+		*hdr = new_size;
+		return ptr;
+	}
+	void *new_ptr = la_arena_alloc(arena, size);
+	memcpy(new_ptr, ptr, old_size);
+	return new_ptr;
+}
+
+// Returns true if ptr points into memory handed out by the arena
+bool la_arena_owns(la_arena const *arena, void const *ptr) {
+	la_assert(arena != NULL);
+	uint8_t const *p = ptr;
+	for(la_arena_chunk const *c = arena->chunks; c != NULL; c = c->next) {
+		if(p >= LA_ARENA_CHUNK_DATA(c) && p < LA_ARENA_CHUNK_DATA(c) + c->used) {
+			return true;
+		}
+		if(c == arena->cur) {
+			break;
+		}
+	}
+	for(la_arena_chunk const *c = arena->large; c != NULL; c = c->next) {
+		if(p >= LA_ARENA_CHUNK_DATA(c) && p < LA_ARENA_CHUNK_DATA(c) + c->used) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Registers a callback to be run when the arena is reset or destroyed.
+// Used by decoders which keep memory not allocated by libacars (eg. by the
+// ASN.1 decoder) in arena-allocated structures.
+void la_arena_defer(la_arena *arena, la_arena_cleanup_func *func, void *data) {
+	la_assert(arena != NULL);
+	la_assert(func != NULL);
+	la_arena_cleanup *c = la_arena_alloc(arena, sizeof(la_arena_cleanup));
+	c->func = func;
+	c->data = data;
+	c->next = arena->cleanups;
+	arena->cleanups = c;
+}
+
+// Releases all blocks allocated from the arena at once. Regular chunks are
+// retained for reuse, so an arena in a steady state does not call malloc at all.
+void la_arena_reset(la_arena *arena) {
+	if(arena == NULL) {
+		return;
+	}
+	la_arena_run_cleanups(arena);
+	la_arena_chunk_list_free(arena->large);
+	arena->large = NULL;
+	arena->cur = arena->chunks;
+	arena->cur->used = 0;
+}
+
+void la_arena_destroy(la_arena *arena) {
+	if(arena == NULL) {
+		return;
+	}
+	if(la_current_arena == arena) {
+		la_current_arena = NULL;
+	}
+	la_arena_run_cleanups(arena);
+	la_arena_chunk_list_free(arena->large);
+	la_arena_chunk_list_free(arena->chunks);
+	free(arena);
+}
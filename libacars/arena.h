@@ -0,0 +1,31 @@
+/*
+ *  This file is a part of libacars
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+
+#ifndef LA_ARENA_H
+#define LA_ARENA_H 1
+
+#include <stddef.h>         // size_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct la_arena_s la_arena;
+
+#define LA_ARENA_DEFAULT_CHUNK_SIZE 65536
+
+// arena.c
+la_arena *la_arena_new(size_t chunk_size);
+la_arena *la_arena_activate(la_arena *arena);
+la_arena *la_arena_current();
+void la_arena_reset(la_arena *arena);
+void la_arena_destroy(la_arena *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !LA_ARENA_H
@@ -235,19 +235,20 @@ void la_arinc_format_json(la_vstring *vstr, void const *data) {
 	la_assert(data);
 
 	la_arinc_msg const *msg = data;
-	la_json_append_string(vstr, "msg_type", imi_props[msg->imi].json_key);
+	la_json_append_string_k(vstr, LA_JSON_KEY("msg_type"), imi_props[msg->imi].json_key);
 	if(msg->imi == ARINC_MSG_UNKNOWN) {
 		return;
 	}
-	la_json_append_bool(vstr, "crc_ok", msg->crc_ok);
-	la_json_append_string(vstr, "gs_addr", msg->gs_addr);
-	la_json_append_string(vstr, "air_addr", msg->air_reg);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("crc_ok"), msg->crc_ok);
+	la_json_append_string_k(vstr, LA_JSON_KEY("gs_addr"), msg->gs_addr);
+	la_json_append_string_k(vstr, LA_JSON_KEY("air_addr"), msg->air_reg);
 }
 
 la_type_descriptor const la_DEF_arinc_message = {
 	.format_text = la_arinc_format_text,
 	.format_json = la_arinc_format_json,
 	.json_key = "arinc622",
+	.json_key_k = LA_JSON_KEY("arinc622"),
 	.destroy = NULL
 };
 
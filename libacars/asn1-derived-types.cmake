@@ -0,0 +1,34 @@
+# Generates asn1-derived-types.h - the list of asn1c-generated types which
+# inherit methods from their base types (ie. those having an
+# *_inherit_TYPE_descriptor function). la_asn1_types_init() initializes
+# their descriptors when the library is loaded.
+#
+# The list is built from the ASN.1 sources listed in asn1/CMakeLists.inc,
+# so it follows the asn1 code when it gets regenerated.
+
+include(${CMAKE_CURRENT_SOURCE_DIR}/asn1/CMakeLists.inc)
+
+set (ASN1_DERIVED_TYPES "// Generated by asn1-derived-types.cmake - do not edit\n")
+foreach (src ${ASN_MODULE_SOURCES})
+	set (src_path "${CMAKE_CURRENT_SOURCE_DIR}/asn1/${src}")
+	set_property (DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${src_path})
+	file (STRINGS ${src_path} inherit_funcs REGEX "_inherit_TYPE_descriptor\\(asn_TYPE_descriptor_t \\*td\\) {")
+	if (inherit_funcs)
+		file (STRINGS ${src_path} type_defs REGEX "^asn_TYPE_descriptor_t asn_DEF_[A-Za-z0-9_]+ = {")
+		foreach (type_def ${type_defs})
+			string (REGEX REPLACE "^asn_TYPE_descriptor_t asn_DEF_([A-Za-z0-9_]+) = {$" "\\1" type_name "${type_def}")
+			string (APPEND ASN1_DERIVED_TYPES "LA_ASN1_DERIVED_TYPE(${type_name})\n")
+		endforeach()
+	endif()
+endforeach()
+set_property (DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${CMAKE_CURRENT_SOURCE_DIR}/asn1/CMakeLists.inc)
+
+if (EXISTS ${CMAKE_CURRENT_BINARY_DIR}/asn1-derived-types.h)
+	file (READ ${CMAKE_CURRENT_BINARY_DIR}/asn1-derived-types.h ASN1_DERIVED_TYPES_)
+else()
+	set (ASN1_DERIVED_TYPES_ "")
+endif()
+
+if (NOT "${ASN1_DERIVED_TYPES}" STREQUAL "${ASN1_DERIVED_TYPES_}")
+	file (WRITE ${CMAKE_CURRENT_BINARY_DIR}/asn1-derived-types.h "${ASN1_DERIVED_TYPES}")
+endif()
@@ -11,13 +11,29 @@
 #include <libacars/asn1/BOOLEAN.h>              // BOOLEAN_t
 #include <libacars/asn1/constr_CHOICE.h>        // _fetch_present_idx()
 #include <libacars/asn1/asn_SET_OF.h>           // _A_CSET_FROM_VOID()
-#include <libacars/asn1-util.h>                 // LA_ASN1_FORMATTER_FUNC
+#include <libacars/asn1-util.h>                 // LA_ASN1_FORMATTER_FUNC, LA_ASN1_JSON
 #include <libacars/macros.h>                    // la_debug_print
 #include <libacars/dict.h>                      // la_dict_search
 #include <libacars/util.h>                      // la_reverse
-#include <libacars/vstring.h>                   // la_vstring, la_vstring_append_sprintf(), LA_ISPRINTF
+#include <libacars/vstring.h>                   // la_vstring, la_vstring_append_*(), LA_ISPRINTF
 #include <libacars/json.h>                      // la_json_*()
 
+// Starts a text line with "<label>: " (or just the indentation if there is no label)
+static void la_asn1_label_start(la_vstring *vstr, int indent, char const *label) {
+	la_vstring_append_indent(vstr, indent);
+	if(label != NULL) {
+		la_vstring_append_string(vstr, label);
+		la_vstring_append_buffer(vstr, ": ", 2);
+	}
+}
+
+// Prints "<text><suffix>", indented
+static void la_asn1_line_print(la_vstring *vstr, int indent, char const *text, char const *suffix) {
+	la_vstring_append_indent(vstr, indent);
+	la_vstring_append_string(vstr, text);
+	la_vstring_append_string(vstr, suffix);
+}
+
 char const *la_asn1_value2enum(asn_TYPE_descriptor_t *td, long value) {
 	if(td == NULL) return NULL;
 	asn_INTEGER_enum_map_t const *enum_map = INTEGER_map_value2enum(td->specifics, value);
@@ -28,35 +44,41 @@ char const *la_asn1_value2enum(asn_TYPE_descriptor_t *td, long value) {
 void la_format_INTEGER_with_unit_as_text(la_asn1_formatter_params p,
 		char const *unit, double multiplier, int decimal_places) {
 	long const *val = p.sptr;
-	LA_ISPRINTF(p.vstr, p.indent, "%s: %.*f%s\n", p.label, decimal_places, (double)(*val) * multiplier, unit);
+	la_asn1_label_start(p.vstr, p.indent, p.label);
+	la_vstring_append_double(p.vstr, (double)(*val) * multiplier, decimal_places);
+	la_vstring_append_string(p.vstr, unit);
+	LA_EOL(p.vstr);
 }
 
 void la_format_INTEGER_with_unit_as_json(la_asn1_formatter_params p,
 		char const *unit, double multiplier) {
 	long const *val = p.sptr;
-	la_json_object_start(p.vstr, p.label);
-	la_json_append_double(p.vstr, "val", (double)(*val) * multiplier);
-	la_json_append_string(p.vstr, "unit", unit);
+	LA_ASN1_JSON(object_start, p);
+	la_json_append_double_k(p.vstr, LA_JSON_KEY("val"), (double)(*val) * multiplier);
+	la_json_append_string_k(p.vstr, LA_JSON_KEY("unit"), unit);
 	la_json_object_end(p.vstr);
 }
 
 void la_format_INTEGER_as_ENUM_as_text(la_asn1_formatter_params p, la_dict const *value_labels) {
 	long const *val = p.sptr;
 	char const *val_label = la_dict_search(value_labels, (int)(*val));
+	la_asn1_label_start(p.vstr, p.indent, p.label);
 	if(val_label != NULL) {
-		LA_ISPRINTF(p.vstr, p.indent, "%s: %s\n", p.label, val_label);
+		la_vstring_append_string(p.vstr, val_label);
+		LA_EOL(p.vstr);
 	} else {
-		LA_ISPRINTF(p.vstr, p.indent, "%s: %ld (unknown)\n", p.label, *val);
+		la_vstring_append_int64(p.vstr, *val);
+		la_vstring_append_string(p.vstr, " (unknown)\n");
 	}
 }
 
 void la_format_INTEGER_as_ENUM_as_json(la_asn1_formatter_params p, la_dict const *value_labels) {
 	long const *val = p.sptr;
-	la_json_object_start(p.vstr, p.label);
-	la_json_append_int64(p.vstr, "value", (int)(*val));
+	LA_ASN1_JSON(object_start, p);
+	la_json_append_int64_k(p.vstr, LA_JSON_KEY("value"), (int)(*val));
 	char const *val_label = la_dict_search(value_labels, (int)(*val));
 	if(val_label != NULL) {
-		la_json_append_string(p.vstr, "value_descr", val_label);
+		la_json_append_string_k(p.vstr, LA_JSON_KEY("value_descr"), val_label);
 	}
 	la_json_object_end(p.vstr);
 }
@@ -66,13 +88,13 @@ void la_format_CHOICE_as_text(la_asn1_formatter_params p, la_dict const *choice_
 	asn_CHOICE_specifics_t *specs = p.td->specifics;
 	int present = _fetch_present_idx(p.sptr, specs->pres_offset, specs->pres_size);
 	if(p.label != NULL) {
-		LA_ISPRINTF(p.vstr, p.indent, "%s:\n", p.label);
+		la_asn1_line_print(p.vstr, p.indent, p.label, ":\n");
 		p.indent++;
 	}
 	if(choice_labels != NULL) {
 		char const *descr = la_dict_search(choice_labels, present);
 		if(descr != NULL) {
-			LA_ISPRINTF(p.vstr, p.indent, "%s\n", descr);
+			la_asn1_line_print(p.vstr, p.indent, descr, "\n");
 		} else {
 			LA_ISPRINTF(p.vstr, p.indent, "<no description for CHOICE value %d>\n", present);
 		}
@@ -85,7 +107,7 @@ void la_format_CHOICE_as_text(la_asn1_formatter_params p, la_dict const *choice_
 		if(elm->flags & ATF_POINTER) {
 			memb_ptr = *(void const * const *)((char const *)p.sptr + elm->memb_offset);
 			if(!memb_ptr) {
-				LA_ISPRINTF(p.vstr, p.indent, "%s: <not present>\n", elm->name);
+				la_asn1_line_print(p.vstr, p.indent, elm->name, ": <not present>\n");
 				return;
 			}
 		} else {
@@ -104,10 +126,10 @@ void la_format_CHOICE_as_json(la_asn1_formatter_params p, la_dict const *choice_
 		la_asn1_formatter_func cb) {
 	asn_CHOICE_specifics_t const *specs = p.td->specifics;
 	int present = _fetch_present_idx(p.sptr, specs->pres_offset, specs->pres_size);
-	la_json_object_start(p.vstr, p.label);
+	LA_ASN1_JSON(object_start, p);
 	if(choice_labels != NULL) {
 		char const *descr = la_dict_search(choice_labels, present);
-		la_json_append_string(p.vstr, "choice_label", descr != NULL ? descr : "");
+		la_json_append_string_k(p.vstr, LA_JSON_KEY("choice_label"), descr != NULL ? descr : "");
 	}
 	if(present > 0 && present <= p.td->elements_count) {
 		asn_TYPE_member_t *elm = &p.td->elements[present-1];
@@ -121,8 +143,8 @@ void la_format_CHOICE_as_json(la_asn1_formatter_params p, la_dict const *choice_
 		} else {
 			memb_ptr = (void const *)((char const *)p.sptr + elm->memb_offset);
 		}
-		la_json_append_string(p.vstr, "choice", elm->name);
-		la_json_object_start(p.vstr, "data");
+		la_json_append_string_k(p.vstr, LA_JSON_KEY("choice"), elm->name);
+		la_json_object_start_k(p.vstr, LA_JSON_KEY("data"));
 		p.td = elm->type;
 		p.sptr = memb_ptr;
 		cb(p);
@@ -134,7 +156,7 @@ end:
 
 void la_format_SEQUENCE_as_text(la_asn1_formatter_params p, la_asn1_formatter_func cb) {
 	if(p.label != NULL) {
-		LA_ISPRINTF(p.vstr, p.indent, "%s:\n", p.label);
+		la_asn1_line_print(p.vstr, p.indent, p.label, ":\n");
 		p.indent++;
 	}
 	la_asn1_formatter_params cb_p = p;
@@ -161,7 +183,7 @@ void la_format_SEQUENCE_as_text(la_asn1_formatter_params p, la_asn1_formatter_fu
 // JSON keys will clash.
 void la_format_SEQUENCE_as_json(la_asn1_formatter_params p, la_asn1_formatter_func cb) {
 	la_asn1_formatter_params cb_p = p;
-	la_json_object_start(p.vstr, p.label);
+	LA_ASN1_JSON(object_start, p);
 	for(int edx = 0; edx < p.td->elements_count; edx++) {
 		asn_TYPE_member_t *elm = &p.td->elements[edx];
 		void const *memb_ptr;
@@ -183,7 +205,7 @@ void la_format_SEQUENCE_as_json(la_asn1_formatter_params p, la_asn1_formatter_fu
 
 void la_format_SEQUENCE_OF_as_text(la_asn1_formatter_params p, la_asn1_formatter_func cb) {
 	if(p.label != NULL) {
-		LA_ISPRINTF(p.vstr, p.indent, "%s:\n", p.label);
+		la_asn1_line_print(p.vstr, p.indent, p.label, ":\n");
 		p.indent++;
 	}
 	asn_TYPE_member_t *elm = p.td->elements;
@@ -200,7 +222,7 @@ void la_format_SEQUENCE_OF_as_text(la_asn1_formatter_params p, la_asn1_formatter
 }
 
 void la_format_SEQUENCE_OF_as_json(la_asn1_formatter_params p, la_asn1_formatter_func cb) {
-	la_json_array_start(p.vstr, p.label);
+	LA_ASN1_JSON(array_start, p);
 	asn_TYPE_member_t *elm = p.td->elements;
 	asn_anonymous_set_ const *list = _A_CSET_FROM_VOID(p.sptr);
 	for(int i = 0; i < list->count; i++) {
@@ -236,14 +258,14 @@ void la_format_BIT_STRING_as_text(la_asn1_formatter_params p, la_dict const *bit
 		bits_unused = 0;
 	}
 	if(p.label != NULL) {
-		LA_ISPRINTF(p.vstr, p.indent, "%s: ", p.label);
+		la_asn1_label_start(p.vstr, p.indent, p.label);
 	}
 	for(int i = 0; i < len; val = (val << 8) | bs->buf[i++])
 		;
 	la_debug_print(D_INFO, "val: 0x%08x\n", val);
 	val &= (~0u << bits_unused);    // zeroize unused bits
 	if(val == 0) {
-		la_vstring_append_sprintf(p.vstr, "none\n");
+		la_vstring_append_string(p.vstr, "none\n");
 		goto end;
 	}
 	val = la_reverse(val, len * 8);
@@ -251,8 +273,10 @@ void la_format_BIT_STRING_as_text(la_asn1_formatter_params p, la_dict const *bit
 	for(la_dict const *ptr = bit_labels; ptr->val != NULL; ptr++) {
 		uint32_t shift = (uint32_t)ptr->id;
 		if((val >> shift) & 1) {
-			la_vstring_append_sprintf(p.vstr, "%s%s",
-					(first ? "" : ", "), (char *)ptr->val);
+			if(!first) {
+				la_vstring_append_buffer(p.vstr, ", ", 2);
+			}
+			la_vstring_append_string(p.vstr, (char const *)ptr->val);
 			first = false;
 		}
 	}
@@ -278,7 +302,7 @@ void la_format_BIT_STRING_as_json(la_asn1_formatter_params p, la_dict const *bit
 		len = sizeof(val);
 		bits_unused = 0;
 	}
-	la_json_array_start(p.vstr, p.label);
+	LA_ASN1_JSON(array_start, p);
 	for(int i = 0; i < len; val = (val << 8) | bs->buf[i++])
 		;
 	la_debug_print(D_INFO, "val: 0x%08x\n", val);
@@ -298,11 +322,7 @@ end:
 }
 
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_any_as_text) {
-	if(p.label != NULL) {
-		LA_ISPRINTF(p.vstr, p.indent, "%s: ", p.label);
-	} else {
-		LA_ISPRINTF(p.vstr, p.indent, "%s", "");
-	}
+	la_asn1_label_start(p.vstr, p.indent, p.label);
 	asn_sprintf(p.vstr, p.td, p.sptr, 1);
 	LA_EOL(p.vstr);
 }
@@ -310,19 +330,19 @@ LA_ASN1_FORMATTER_FUNC(la_asn1_format_any_as_text) {
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_any_as_string_as_json) {
 	la_vstring *tmp = la_vstring_new();
 	asn_sprintf(tmp, p.td, p.sptr, 0);
-	la_json_append_octet_string_as_string(p.vstr, p.label, (uint8_t const *)tmp->str, tmp->len);
+	LA_ASN1_JSON(append_octet_string_as_string, p, (uint8_t const *)tmp->str, tmp->len);
 	la_vstring_destroy(tmp, true);
 }
 
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_label_only_as_text) {
 	if(p.label != NULL) {
-		LA_ISPRINTF(p.vstr, p.indent, "%s\n", p.label);
+		la_asn1_line_print(p.vstr, p.indent, p.label, "\n");
 	}
 }
 
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_label_only_as_json) {
 	if(p.label != NULL) {
-		la_json_object_start(p.vstr, p.label);
+		LA_ASN1_JSON(object_start, p);
 		la_json_object_end(p.vstr);
 	}
 }
@@ -330,34 +350,36 @@ LA_ASN1_FORMATTER_FUNC(la_asn1_format_label_only_as_json) {
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_ENUM_as_text) {
 	long const value = *(long const *)p.sptr;
 	char const *s = la_asn1_value2enum(p.td, value);
+	la_asn1_label_start(p.vstr, p.indent, p.label);
 	if(s != NULL) {
-		LA_ISPRINTF(p.vstr, p.indent, "%s: %s\n", p.label, s);
+		la_vstring_append_string(p.vstr, s);
 	} else {
-		LA_ISPRINTF(p.vstr, p.indent, "%s: %ld\n", p.label, value);
+		la_vstring_append_int64(p.vstr, value);
 	}
+	LA_EOL(p.vstr);
 }
 
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_ENUM_as_json) {
 	long const value = *(long const *)p.sptr;
 	char const *s = la_asn1_value2enum(p.td, value);
 	if(s != NULL) {
-		la_json_append_string(p.vstr, p.label, s);
+		LA_ASN1_JSON(append_string, p, s);
 	} else {
-		la_json_append_int64(p.vstr, p.label, value);
+		LA_ASN1_JSON(append_int64, p, value);
 	}
 }
 
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_long_as_json) {
 	long const *valptr = p.sptr;
-	la_json_append_int64(p.vstr, p.label, *valptr);
+	LA_ASN1_JSON(append_int64, p, *valptr);
 }
 
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_bool_as_json) {
 	BOOLEAN_t const *valptr = p.sptr;
-	la_json_append_bool(p.vstr, p.label, (*valptr) ? true : false);
+	LA_ASN1_JSON(append_bool, p, (*valptr) ? true : false);
 }
 
 LA_ASN1_FORMATTER_FUNC(la_asn1_format_OCTET_STRING_as_json) {
 	OCTET_STRING_t const *valptr = p.sptr;
-	la_json_append_octet_string(p.vstr, p.label, valptr->buf, valptr->size);
+	LA_ASN1_JSON(append_octet_string, p, valptr->buf, valptr->size);
 }
@@ -50,6 +50,7 @@ void la_asn1_output(la_asn1_formatter_params p, la_asn1_formatter const *asn1_fo
 		// NULL formatting routine is allowed - it means the type should be silently omitted
 		if(formatter->format != NULL) {
 			p.label = formatter->label;
+			p.json_key = formatter->json_key;
 			(*formatter->format)(p);
 		}
 	} else if(dump_unknown_types) {
@@ -60,3 +61,34 @@ void la_asn1_output(la_asn1_formatter_params p, la_asn1_formatter const *asn1_fo
 		LA_ISPRINTF(p.vstr, p.indent, "%s", "-- ASN.1 dump end\n");
 	}
 }
+
+// asn1c-generated types which are derived from other types (eg. FANSTime
+// from SEQUENCE) copy the methods of their base type into their own,
+// statically allocated descriptor on first use. These writes to shared memory
+// race with each other when messages are decoded in several threads at once.
+// la_asn1_types_init() does the copying upfront, for all such types, when
+// the library is loaded, so that decoders only read the descriptors afterwards.
+// Compilers without constructor support fall back to doing it on first use.
+// The list of such types is generated from the asn1 sources at build time
+// (see asn1-derived-types.cmake).
+#define LA_ASN1_DERIVED_TYPE(t) extern asn_TYPE_descriptor_t asn_DEF_##t;
+#include "asn1-derived-types.h"
+#undef LA_ASN1_DERIVED_TYPE
+
+static asn_TYPE_descriptor_t *la_asn1_derived_types[] = {
+#define LA_ASN1_DERIVED_TYPE(t) &asn_DEF_##t,
+#include "asn1-derived-types.h"
+#undef LA_ASN1_DERIVED_TYPE
+};
+
+#ifdef __GNUC__
+__attribute__ ((constructor))
+#endif
+void la_asn1_types_init() {
+	for(size_t i = 0; i < sizeof(la_asn1_derived_types) / sizeof(la_asn1_derived_types[0]); i++) {
+		asn_TYPE_descriptor_t *td = la_asn1_derived_types[i];
+		// The wrapper does the copying and then calls the base type's free
+		// routine, which is a no-op for a NULL pointer.
+		td->free_struct(td, NULL, 0);
+	}
+}
@@ -10,6 +10,7 @@
 #include <stdint.h>                         // uint8_t
 #include <libacars/asn1/asn_application.h>  // asn_TYPE_descriptor_t
 #include <libacars/vstring.h>               // la_vstring
+#include <libacars/json.h>                  // la_json_key, la_json_*()
 
 // Parameters to the formatter function
 typedef struct {
@@ -18,6 +19,7 @@ typedef struct {
 	asn_TYPE_descriptor_t *td;
 	void const *sptr;
 	int indent;
+	la_json_key const *json_key;    // label rendered as a JSON key (optional)
 } la_asn1_formatter_params;
 
 // Formatter function prototype
@@ -27,13 +29,22 @@ typedef struct {
 	asn_TYPE_descriptor_t *type;
 	la_asn1_formatter_func format;
 	char const *label;
+	la_json_key const *json_key;    // label rendered with LA_JSON_KEY() (optional)
 } la_asn1_formatter;
 
 #define LA_ASN1_FORMATTER_FUNC(x) \
 	void x(la_asn1_formatter_params p)
 
+// Calls la_json_<f>_k() with the pre-rendered key of the value being formatted,
+// if there is one, or la_json_<f>() with its label otherwise
+#define LA_ASN1_JSON(f, p, ...) \
+	((p).json_key != NULL ? \
+	 la_json_##f##_k((p).vstr, (p).json_key, ##__VA_ARGS__) : \
+	 la_json_##f((p).vstr, (p).label, ##__VA_ARGS__))
+
 // asn1-util.c
 int la_asn1_decode_as(asn_TYPE_descriptor_t *td, void **struct_ptr, uint8_t const *buf, int size);
 void la_asn1_output(la_asn1_formatter_params p, la_asn1_formatter const *asn1_formatter_table,
 		size_t asn1_formatter_table_len, bool dump_unknown_types);
+void la_asn1_types_init();
 #endif // !LA_ASN1_UTIL_H
@@ -5,10 +5,14 @@
  */
 
 #include <stdbool.h>
-#include <string.h>                 // strdup
-#include <libacars/macros.h>        // la_assert
+#include <string.h>                 // strdup, strcmp
+#include <libacars/macros.h>        // la_assert, LA_THREAD_LOCAL
 #include <libacars/util.h>          // LA_XCALLOC, LA_XFREE
+#include <libacars/arena.h>         // la_arena_activate
 #include <libacars/hash.h>          // la_hash
+#include <libacars/acars.h>         // LA_ACARS_BEARER_INVALID, la_acars_timeout_profile_get
+#include <libacars/reassembly.h>    // la_reasm_ctx, la_reasm_ctx_config_get
+#include <libacars/configuration.h> // la_config_snapshot
 
 typedef enum {
 	LA_CONFVAR_UNKNOWN = 0,
@@ -54,8 +58,21 @@ static const la_config_option config_defaults[] =
 
 #define CONFIG_DEFAULTS_COUNT (sizeof(config_defaults) / sizeof(la_config_option))
 
+// Global configuration. Until it is modified for the first time (or after
+// la_config_destroy()) it is NULL and readers get values from config_defaults,
+// so that reading the configuration never allocates nor modifies anything.
 static la_hash *config = NULL;
-static void la_config_init();
+
+// Snapshot of the global configuration, which is used when no snapshot has
+// been bound to the reassembly context nor to the calling thread.
+// It is filled when the library is loaded and refreshed by the functions which
+// modify the global configuration, so that readers never write to it.
+static la_config_snapshot global_snapshot;
+static bool global_snapshot_valid = false;
+static void la_config_global_snapshot_update();
+
+// Snapshot bound to the calling thread with la_config_snapshot_bind()
+static LA_THREAD_LOCAL la_config_snapshot const *thread_snapshot = NULL;
 
 // Sets the given config option to the given type/value.
 // Returns true if the option already existed in the config, false otherwise.
@@ -64,6 +81,8 @@ static bool la_config_option_set(char const *name, la_config_item const item) {
 	la_assert(item.type >= 0);
 	la_assert(item.type <= LA_CONFIG_ITEM_TYPE_MAX);
 
+	// Configuration is global, so it must not be allocated from the arena
+	la_arena *saved_arena = la_arena_activate(NULL);
 	if(config == NULL) {
 		la_config_init();
 	}
@@ -71,7 +90,10 @@ static bool la_config_option_set(char const *name, la_config_item const item) {
 	char *new_name = strdup(name);
 	new_item->type = item.type;
 	new_item->value = item.value;
-	return la_hash_insert(config, new_name, new_item);
+	bool ret = la_hash_insert(config, new_name, new_item);
+	la_config_global_snapshot_update();
+	la_arena_activate(saved_arena);
+	return ret;
 }
 
 bool la_config_set_bool(char const *name, bool value) {
@@ -118,18 +140,23 @@ bool la_config_set_str(char const *name, char const *value) {
 	return true;
 }
 
-static la_config_item *la_config_option_get(char const *name) {
+static la_config_item const *la_config_option_get(char const *name) {
 	if(name == NULL) {
-		return false;
+		return NULL;
 	}
 	if(config == NULL) {
-		la_config_init();
+		for(size_t i = 0; i < CONFIG_DEFAULTS_COUNT; i++) {
+			if(strcmp(config_defaults[i].name, name) == 0) {
+				return &config_defaults[i].value;
+			}
+		}
+		return NULL;
 	}
 	return la_hash_lookup(config, name);
 }
 
 bool la_config_get_bool(char const *name, bool *result) {
-	la_config_item *item = la_config_option_get(name);
+	la_config_item const *item = la_config_option_get(name);
 	if(item && item->type == LA_CONFVAR_BOOLEAN) {
 		*result = item->value._bool;
 		return true;
@@ -138,7 +165,7 @@ bool la_config_get_bool(char const *name, bool *result) {
 }
 
 bool la_config_get_int(char const *name, long int *result) {
-	la_config_item *item = la_config_option_get(name);
+	la_config_item const *item = la_config_option_get(name);
 	if(item && item->type == LA_CONFVAR_INTEGER) {
 		*result = item->value._int;
 		return true;
@@ -147,7 +174,7 @@ bool la_config_get_int(char const *name, long int *result) {
 }
 
 bool la_config_get_double(char const *name, double *result) {
-	la_config_item *item = la_config_option_get(name);
+	la_config_item const *item = la_config_option_get(name);
 	if(item && item->type == LA_CONFVAR_DOUBLE) {
 		*result = item->value._double;
 		return true;
@@ -156,7 +183,7 @@ bool la_config_get_double(char const *name, double *result) {
 }
 
 bool la_config_get_str(char const *name, char **result) {
-	la_config_item *item = la_config_option_get(name);
+	la_config_item const *item = la_config_option_get(name);
 	if(item && item->type == LA_CONFVAR_STRING) {
 		*result = item->value._str;
 		return true;
@@ -168,7 +195,9 @@ bool la_config_unset(char *name) {
 	if(config == NULL) {
 		la_config_init();
 	}
-	return la_hash_remove(config, name);
+	bool ret = la_hash_remove(config, name);
+	la_config_global_snapshot_update();
+	return ret;
 }
 
 static void la_config_item_destroy(void *data) {
@@ -184,12 +213,15 @@ static void la_config_item_destroy(void *data) {
 
 void la_config_destroy() {
 	la_hash_destroy(config);
+	config = NULL;
+	la_config_global_snapshot_update();
 }
 
 void la_config_init() {
 	if(config != NULL) {
 		la_config_destroy();
 	}
+	la_arena *saved_arena = la_arena_activate(NULL);
 	config = la_hash_new(la_hash_key_str, la_hash_compare_keys_str,
 			la_simple_free, la_config_item_destroy);
 	la_assert(config != NULL);
@@ -201,4 +233,134 @@ void la_config_init() {
 			(void)la_config_option_set(opt->name, opt->value);
 		}
 	}
+	la_config_global_snapshot_update();
+	la_arena_activate(saved_arena);
+}
+
+// Returns reassembly timeouts for the given ACARS bearer. Invalid bearers
+// get zero timeouts, which cause ACARS reassembly to fail.
+static la_acars_timeout_profile la_config_acars_timeout_profile(long int bearer) {
+	la_acars_timeout_profile const *profile = la_acars_timeout_profile_get(bearer);
+	return profile != NULL ? *profile : (la_acars_timeout_profile){ 0 };
+}
+
+// Fills the snapshot with current values from the global configuration
+static void la_config_snapshot_fill(la_config_snapshot *snap) {
+	*snap = (la_config_snapshot){
+		.acars_bearer = LA_ACARS_BEARER_INVALID,
+		.dump_asn1 = false,
+		.decode_fragments = true,
+		.prettify_xml = false,
+		.prettify_json = false
+	};
+	(void)la_config_get_int("acars_bearer", &snap->acars_bearer);
+	(void)la_config_get_bool("dump_asn1", &snap->dump_asn1);
+	(void)la_config_get_bool("decode_fragments", &snap->decode_fragments);
+	(void)la_config_get_bool("prettify_xml", &snap->prettify_xml);
+	(void)la_config_get_bool("prettify_json", &snap->prettify_json);
+	snap->acars_timeout_profile = la_config_acars_timeout_profile(snap->acars_bearer);
+}
+
+static void la_config_global_snapshot_update() {
+	la_config_snapshot_fill(&global_snapshot);
+	global_snapshot_valid = true;
+}
+
+// Fills the global snapshot when the library is loaded, before any decoder
+// threads are started. Compilers without constructor support fall back to
+// doing it on first use.
+#ifdef __GNUC__
+__attribute__ ((constructor))
+#endif
+static void la_config_global_snapshot_init() {
+	la_config_global_snapshot_update();
+}
+
+// Creates a snapshot of the current global configuration.
+// The snapshot may then be modified with la_config_snapshot_set_*() functions.
+// Once it is in use, it must not be modified anymore.
+la_config_snapshot *la_config_snapshot_new() {
+	// Snapshots are long-lived, so they must not be allocated from the arena
+	la_arena *saved_arena = la_arena_activate(NULL);
+	LA_NEW(la_config_snapshot, snap);
+	la_arena_activate(saved_arena);
+	la_config_snapshot_fill(snap);
+	return snap;
+}
+
+bool la_config_snapshot_set_bool(la_config_snapshot *snap, char const *name, bool value) {
+	if(snap == NULL || name == NULL) {
+		return false;
+	}
+	if(strcmp(name, "dump_asn1") == 0) {
+		snap->dump_asn1 = value;
+	} else if(strcmp(name, "decode_fragments") == 0) {
+		snap->decode_fragments = value;
+	} else if(strcmp(name, "prettify_xml") == 0) {
+		snap->prettify_xml = value;
+	} else if(strcmp(name, "prettify_json") == 0) {
+		snap->prettify_json = value;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+bool la_config_snapshot_set_int(la_config_snapshot *snap, char const *name, long int value) {
+	if(snap == NULL || name == NULL) {
+		return false;
+	}
+	if(strcmp(name, "acars_bearer") == 0) {
+		snap->acars_bearer = value;
+		snap->acars_timeout_profile = la_config_acars_timeout_profile(value);
+	} else {
+		return false;
+	}
+	return true;
+}
+
+// Overrides ACARS reassembly timeouts implied by the acars_bearer setting
+// of the snapshot
+bool la_config_snapshot_set_acars_timeout_profile(la_config_snapshot *snap,
+		la_acars_timeout_profile const *timeout_profile) {
+	if(snap == NULL || timeout_profile == NULL) {
+		return false;
+	}
+	snap->acars_timeout_profile = *timeout_profile;
+	return true;
+}
+
+void la_config_snapshot_destroy(la_config_snapshot *snap) {
+	LA_XFREE(snap);
+}
+
+// Makes the given snapshot the configuration used by all decoders and
+// formatters in the calling thread. NULL restores the global configuration.
+// Returns the snapshot which was bound before the call.
+la_config_snapshot const *la_config_snapshot_bind(la_config_snapshot const *snap) {
+	la_config_snapshot const *prev = thread_snapshot;
+	thread_snapshot = snap;
+	return prev;
+}
+
+// Returns the configuration which applies to the current decoding operation.
+// Snapshot bound to the reassembly context (if any) takes precedence over
+// the one bound to the calling thread, which in turn takes precedence over
+// the global configuration.
+// When a snapshot is bound to the context or to the thread, no global state
+// is accessed, so decoders may run concurrently in multiple threads.
+la_config_snapshot const *la_config_current(la_reasm_ctx const *rctx) {
+	if(rctx != NULL) {
+		la_config_snapshot const *snap = la_reasm_ctx_config_get(rctx);
+		if(snap != NULL) {
+			return snap;
+		}
+	}
+	if(thread_snapshot != NULL) {
+		return thread_snapshot;
+	}
+	if(global_snapshot_valid == false) {
+		la_config_global_snapshot_init();
+	}
+	return &global_snapshot;
 }
@@ -0,0 +1,31 @@
+/*
+ *  This file is a part of libacars
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+
+#ifndef LA_CONFIGURATION_H
+#define LA_CONFIGURATION_H 1
+
+#include <stdbool.h>
+#include <libacars/libacars.h>              // la_config_snapshot
+#include <libacars/reassembly.h>            // la_reasm_ctx
+#include <libacars/acars.h>                 // la_acars_timeout_profile
+
+// Pre-resolved values of all configuration options used by decoders and
+// formatters. When an option is not set, the respective field holds the
+// value which decoders assumed before snapshots were introduced.
+struct la_config_snapshot_s {
+	long int acars_bearer;
+	la_acars_timeout_profile acars_timeout_profile;     // resolved from acars_bearer,
+	                                                    // unless set explicitly
+	bool dump_asn1;
+	bool decode_fragments;
+	bool prettify_xml;
+	bool prettify_json;
+};
+
+// configuration.c
+la_config_snapshot const *la_config_current(la_reasm_ctx const *rctx);
+
+#endif // !LA_CONFIGURATION_H
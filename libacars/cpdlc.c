@@ -15,11 +15,23 @@
 #include <libacars/asn1-util.h>                     // la_asn1_decode_as()
 #include <libacars/asn1-format-cpdlc.h>             // la_asn1_output_cpdlc_as_*()
 #include <libacars/cpdlc.h>                         // la_cpdlc_msg
-#include <libacars/libacars.h>                      // la_proto_node, la_config_get_bool, la_proto_tree_find_protocol
+#include <libacars/libacars.h>                      // la_proto_node, la_proto_tree_find_protocol
+#include <libacars/configuration.h>                 // la_config_current()
 #include <libacars/macros.h>                        // la_debug_print
-#include <libacars/util.h>                          // LA_XFREE
+#include <libacars/util.h>                          // LA_XFREE, la_arena_defer()
+#include <libacars/arena.h>                         // la_arena_current()
 #include <libacars/vstring.h>                       // la_vstring, la_vstring_append_sprintf()
-#include <libacars/json.h>                          // la_json_append_bool()
+#include <libacars/json.h>                          // la_json_append_bool_k()
+
+// Frees the ASN.1 structure decoded by asn1c. It is allocated on the heap
+// even if an arena is active, so it has to be released separately.
+static void la_cpdlc_asn1_data_free(void *data) {
+	la_cpdlc_msg *msg = data;
+	if(msg->asn_type != NULL && msg->data != NULL) {
+		msg->asn_type->free_struct(msg->asn_type, msg->data, 0);
+		msg->data = NULL;
+	}
+}
 
 la_proto_node *la_cpdlc_parse(uint8_t const *buf, int len, la_msg_dir msg_dir) {
 	if(buf == NULL)
@@ -48,6 +60,10 @@ la_proto_node *la_cpdlc_parse(uint8_t const *buf, int len, la_msg_dir msg_dir) {
 	} else {
 		msg->err = false;
 	}
+	la_arena *arena = la_arena_current();
+	if(arena != NULL && msg->data != NULL) {
+		la_arena_defer(arena, la_cpdlc_asn1_data_free, msg);
+	}
 	return node;
 }
 
@@ -63,12 +79,10 @@ void la_cpdlc_format_text(la_vstring *vstr, void const *data, int indent) {
 	}
 	if(msg->asn_type != NULL) {
 		if(msg->data != NULL) {
-			bool dump_asn1 = false;
-			(void)la_config_get_bool("dump_asn1", &dump_asn1);
-			if(dump_asn1 == true) {
+			if(la_config_current(NULL)->dump_asn1 == true) {
 				LA_ISPRINTF(vstr, indent, "ASN.1 dump:\n");
 				// asn_fprint does not indent the first line
-				LA_ISPRINTF(vstr, indent + 1, "");
+				la_vstring_append_indent(vstr, indent + 1);
 				asn_sprintf(vstr, msg->asn_type, msg->data, indent + 2);
 				LA_EOL(vstr);
 			}
@@ -89,7 +103,7 @@ void la_cpdlc_format_json(la_vstring *vstr, void const *data) {
 	la_assert(data);
 
 	la_cpdlc_msg const *msg = data;
-	la_json_append_bool(vstr, "err", msg->err);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("err"), msg->err);
 	if(msg->err == true) {
 		return;
 	}
@@ -108,10 +122,7 @@ void la_cpdlc_destroy(void *data) {
 	if(data == NULL) {
 		return;
 	}
-	la_cpdlc_msg *msg = data;
-	if(msg->asn_type != NULL) {
-		msg->asn_type->free_struct(msg->asn_type, msg->data, 0);
-	}
+	la_cpdlc_asn1_data_free(data);
 	LA_XFREE(data);
 }
 
@@ -119,6 +130,7 @@ la_type_descriptor const la_DEF_cpdlc_message = {
 	.format_text = la_cpdlc_format_text,
 	.format_json = la_cpdlc_format_json,
 	.json_key = "cpdlc",
+	.json_key_k = LA_JSON_KEY("cpdlc"),
 	.destroy = la_cpdlc_destroy
 };
 
@@ -9,9 +9,20 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>                 // size_t
+#include <libacars/util.h>          // la_octet_string
 
 uint16_t la_crc16_arinc(uint8_t const *data, uint32_t len, uint16_t crc_init);
 uint16_t la_crc16_ccitt(uint8_t const *data, uint32_t len, uint16_t crc_init);
+uint16_t la_crc16_ccitt_strip_parity(uint8_t const *src, uint8_t *dst, uint32_t len,
+		uint32_t strip_len, uint32_t nul_start, uint32_t nul_end,
+		uint32_t *parity_err_cnt, uint16_t crc_init);
+uint32_t la_strip_parity(uint8_t const *src, uint8_t *dst, uint32_t len,
+		uint32_t nul_start, uint32_t nul_end);
+void la_crc16_arinc_batch(la_octet_string const *bufs, size_t cnt, uint16_t crc_init,
+		uint16_t *results);
+void la_crc16_ccitt_batch(la_octet_string const *bufs, size_t cnt, uint16_t crc_init,
+		uint16_t *results);
 uint32_t la_crc32_arinc665(uint8_t const *data, uint32_t len, uint32_t crc_init);
 
 #endif // !LA_CRC_ARINC_H
@@ -5,28 +5,38 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>                     // size_t, ptrdiff_t
 #include <stdint.h>
 #include <string.h>                     // strcmp
 #include <libacars/macros.h>            // la_assert
 #include <libacars/hash.h>              // la_hash
-#include <libacars/list.h>              // la_list
 #include <libacars/util.h>              // LA_XCALLOC, LA_XFREE
 
-#define LA_HASH_SIZE 173
+// Open-addressing hash table with Robin Hood probing and backward shift deletion.
+// Capacity is always a power of two. The table grows when its load factor
+// exceeds LA_HASH_MAX_LOAD_NUM / LA_HASH_MAX_LOAD_DEN.
+#define LA_HASH_MIN_CAPACITY 16
+#define LA_HASH_MAX_LOAD_NUM 3
+#define LA_HASH_MAX_LOAD_DEN 4
+
+typedef struct {
+	void *key;
+	void *value;
+	uint32_t hash;                      // hash of the key (cached)
+	uint32_t dist;                      // distance from the home slot + 1 (0 = empty slot)
+} la_hash_slot;
 
 struct la_hash_s {
 	la_hash_func *compute_hash;
 	la_hash_compare_func *compare_keys;
 	la_hash_key_destroy_func *destroy_key;
 	la_hash_value_destroy_func *destroy_value;
-	la_list *buckets[LA_HASH_SIZE];
+	la_hash_slot *slots;
+	size_t capacity;                    // number of slots (a power of two)
+	size_t count;                       // number of occupied slots
+	uint32_t shift;                     // 32 - log2(capacity)
 };
 
-typedef struct {
-	void *key;
-	void *value;
-} la_hash_element;
-
 uint32_t la_hash_string(char const *str, uint32_t h) {
 	int h_work = (int)h;
 	for(char const *p = str; *p != '\0'; p++) {
@@ -63,54 +73,123 @@ bool la_hash_compare_keys_str(void const *key1, void const *key2) {
 	return (key1 != NULL && key2 != NULL && strcmp(key1, key2) == 0);
 }
 
-la_hash *la_hash_new(la_hash_func *compute_hash, la_hash_compare_func *compare_keys,
-		la_hash_key_destroy_func *destroy_key, la_hash_value_destroy_func *destroy_value) {
+// Returns the smallest power of two capacity which fits the given number
+// of entries without exceeding the maximum load factor.
+static size_t la_hash_capacity_for(size_t entries) {
+	size_t capacity = LA_HASH_MIN_CAPACITY;
+	while(capacity * LA_HASH_MAX_LOAD_NUM / LA_HASH_MAX_LOAD_DEN < entries) {
+		capacity <<= 1;
+	}
+	return capacity;
+}
+
+static void la_hash_slots_alloc(la_hash *h, size_t capacity) {
+	h->slots = LA_XCALLOC(capacity, sizeof(la_hash_slot));
+	h->capacity = capacity;
+	h->shift = 32;
+	for(size_t c = capacity; c > 1; c >>= 1) {
+		h->shift--;
+	}
+}
+
+// Maps the hash to its home slot. User-supplied hash functions are often weak
+// in their low bits, so Fibonacci hashing is used to spread the values.
+static inline size_t la_hash_home_slot(la_hash const *h, uint32_t hash) {
+	return (size_t)((hash * 2654435761u) >> h->shift) & (h->capacity - 1);
+}
+
+la_hash *la_hash_new_sized(la_hash_func *compute_hash, la_hash_compare_func *compare_keys,
+		la_hash_key_destroy_func *destroy_key, la_hash_value_destroy_func *destroy_value,
+		size_t capacity_hint) {
 
 	LA_NEW(la_hash, h);
 	h->compute_hash = (compute_hash ? compute_hash : la_hash_key_str);
 	h->compare_keys = (compare_keys ? compare_keys : la_hash_compare_keys_str);
 	h->destroy_key = destroy_key;        // no default; might be NULL
 	h->destroy_value = destroy_value;    // no default; might be NULL
+	la_hash_slots_alloc(h, la_hash_capacity_for(capacity_hint));
 	return h;
 }
 
-static size_t la_hash_get_bucket(la_hash const *h, void const *key) {
-	return h->compute_hash(key) % LA_HASH_SIZE;
+la_hash *la_hash_new(la_hash_func *compute_hash, la_hash_compare_func *compare_keys,
+		la_hash_key_destroy_func *destroy_key, la_hash_value_destroy_func *destroy_value) {
+	return la_hash_new_sized(compute_hash, compare_keys, destroy_key, destroy_value, 0);
 }
 
-static la_list *la_hash_lookup_list_node(la_hash const *h, void const *key,
-		la_list **prev_node) {
-	la_assert(h != NULL);
-	la_assert(key != NULL);
+// Returns the index of the slot holding the given key or -1 if not found
+static ptrdiff_t la_hash_find_slot(la_hash const *h, void const *key, uint32_t hash) {
+	size_t mask = h->capacity - 1;
+	size_t idx = la_hash_home_slot(h, hash);
+	for(uint32_t dist = 1; ; dist++, idx = (idx + 1) & mask) {
+		la_hash_slot const *slot = h->slots + idx;
+		// An empty slot or an entry which is closer to its home slot than
+		// the searched key would be means that the key is not present.
+		if(slot->dist < dist) {
+			return -1;
+		}
+		if(slot->hash == hash && h->compare_keys(key, slot->key) == true) {
+			return (ptrdiff_t)idx;
+		}
+	}
+}
 
-	size_t bucket = la_hash_get_bucket(h, key);
-	la_list *l = h->buckets[bucket];
-	la_list *pl = NULL;
-	la_hash_element *elem;
-	for(; l != NULL; pl = l, l = la_list_next(l)) {
-		elem = l->data;
-		if(h->compare_keys(key, elem->key) == true) {
+// Places a new entry in the table. The key must not be present in the table
+// and there must be at least one free slot.
+static void la_hash_place(la_hash *h, la_hash_slot entry) {
+	size_t mask = h->capacity - 1;
+	size_t idx = la_hash_home_slot(h, entry.hash);
+	entry.dist = 1;
+	for(;; idx = (idx + 1) & mask, entry.dist++) {
+		la_hash_slot *slot = h->slots + idx;
+		if(slot->dist == 0) {
+			*slot = entry;
 			break;
 		}
+		// Robin Hood: take the slot from an entry which is closer
+		// to its home than the one being inserted
+		if(slot->dist < entry.dist) {
+			la_hash_slot tmp = *slot;
+			*slot = entry;
+			entry = tmp;
+		}
 	}
-	// Give back pointer to the previous node if the caller wants it
-	if(prev_node != NULL) {
-		*prev_node = pl;
+	h->count++;
+}
+
+static void la_hash_grow(la_hash *h) {
+	la_hash_slot *old_slots = h->slots;
+	size_t old_capacity = h->capacity;
+	la_hash_slots_alloc(h, old_capacity << 1);
+	h->count = 0;
+	for(size_t i = 0; i < old_capacity; i++) {
+		if(old_slots[i].dist != 0) {
+			la_hash_place(h, old_slots[i]);
+		}
 	}
-	// Return the node containing the requested key (or NULL if not found)
-	return l;
+	LA_XFREE(old_slots);
+}
+
+// Empties the slot at idx and shifts subsequent entries of the same cluster
+// back by one slot, so that no tombstones are needed.
+static void la_hash_remove_slot(la_hash *h, size_t idx) {
+	size_t mask = h->capacity - 1;
+	size_t next = (idx + 1) & mask;
+	while(h->slots[next].dist > 1) {
+		h->slots[idx] = h->slots[next];
+		h->slots[idx].dist--;
+		idx = next;
+		next = (next + 1) & mask;
+	}
+	h->slots[idx] = (la_hash_slot){ 0 };
+	h->count--;
 }
 
 void *la_hash_lookup(la_hash const *h, void const *key) {
 	la_assert(h != NULL);
 	la_assert(key != NULL);
 
-	la_list *list_node = la_hash_lookup_list_node(h, key, NULL);
-	if(list_node == NULL) {
-		return NULL;
-	}
-	la_hash_element *elem = list_node->data;
-	return (void *)elem->value;
+	ptrdiff_t idx = la_hash_find_slot(h, key, h->compute_hash(key));
+	return idx < 0 ? NULL : h->slots[idx].value;
 }
 
 // Inserts the new key into the hash and assigns it a value.  Key and value
@@ -123,22 +202,22 @@ bool la_hash_insert(la_hash *h, void *key, void *value) {
 	la_assert(h != NULL);
 	la_assert(key != NULL);
 
-	la_list *list_node = la_hash_lookup_list_node(h, key, NULL);
-	if(list_node != NULL) {
+	uint32_t hash = h->compute_hash(key);
+	ptrdiff_t idx = la_hash_find_slot(h, key, hash);
+	if(idx >= 0) {
 		// Key already exists - insert the new value, free the old value,
 		// preserve the old key, free the new key
-		la_hash_element *elem = list_node->data;
+		la_hash_slot *slot = h->slots + idx;
 		la_hash_destroy_key(h, key);
-		la_hash_destroy_value(h, elem->value);
-		elem->value = value;
+		la_hash_destroy_value(h, slot->value);
+		slot->value = value;
 		return true;
 	}
 	// Key not found - create new hash entry
-	LA_NEW(la_hash_element, elem);
-	elem->key = key;
-	elem->value = value;
-	size_t bucket = la_hash_get_bucket(h, key);
-	h->buckets[bucket] = la_list_append(h->buckets[bucket], elem);
+	if((h->count + 1) * LA_HASH_MAX_LOAD_DEN > h->capacity * LA_HASH_MAX_LOAD_NUM) {
+		la_hash_grow(h);
+	}
+	la_hash_place(h, (la_hash_slot){ .key = key, .value = value, .hash = hash });
 	return false;
 }
 
@@ -149,82 +228,67 @@ bool la_hash_remove(la_hash *h, void *key) {
 	la_assert(h != NULL);
 	la_assert(key != NULL);
 
-	la_list *prev_node = NULL;
-	la_list *list_node = la_hash_lookup_list_node(h, key, &prev_node);
-	if(list_node == NULL) {
+	ptrdiff_t idx = la_hash_find_slot(h, key, h->compute_hash(key));
+	if(idx < 0) {
 		return false;
 	}
-	// If prev_node is not NULL, then join two list parts together.
-	// Otherwise replace the top of the list in the bucket.
-	if(prev_node != NULL) {
-		prev_node->next = list_node->next;
-	} else {
-		size_t bucket = la_hash_get_bucket(h, key);
-		h->buckets[bucket] = list_node->next;
-	}
-	list_node->next = NULL;
-	// Now free the key and value
-	la_hash_element *elem = list_node->data;
-	la_hash_destroy_key(h, elem->key);
-	la_hash_destroy_value(h, elem->value);
-	// This will free elem too
-	// XXX: use la_hash_element_destroy instead?
-	la_list_free(list_node);
+	// Take the entry out of the table before calling destructors, as the
+	// given key might be the same object as the key stored in the hash.
+	la_hash_slot removed = h->slots[idx];
+	la_hash_remove_slot(h, (size_t)idx);
+	la_hash_destroy_key(h, removed.key);
+	la_hash_destroy_value(h, removed.value);
 	return true;
 }
 
-static void la_free_noop(void *data) {
-	LA_UNUSED(data);
-	// noop
-}
-
 // Iterates over hash entries executing la_hash_if_func() for each key-value
 // pair. If the func returns true, removes the entry from the hash.
+// Each entry is visited exactly once.
 int la_hash_foreach_remove(la_hash *h, la_hash_if_func *if_func, void *if_func_ctx) {
 	la_assert(h != NULL);
 	la_assert(if_func != NULL);
 
-	la_list *keys_to_delete = NULL;
+	if(h->count == 0) {
+		return 0;
+	}
+	// Start right after an empty slot. Clusters never span an empty slot and
+	// backward shift deletion only moves entries which have not been visited
+	// yet towards the current position, so no entry is skipped or visited twice.
+	size_t mask = h->capacity - 1;
+	size_t start = 0;
+	while(h->slots[start].dist != 0) {
+		start++;
+	}
 	int num_keys_deleted = 0;
-	for(size_t i = 0; i < LA_HASH_SIZE; i++) {
-		for(la_list *l = h->buckets[i]; l != NULL; l = la_list_next(l)) {
-			la_hash_element *elem = l->data;
-			if(if_func(elem->key, elem->value, if_func_ctx) == true) {
-				keys_to_delete = la_list_append(keys_to_delete, elem->key);
-				num_keys_deleted++;
-			}
+	size_t idx = (start + 1) & mask;
+	while(idx != start) {
+		la_hash_slot *slot = h->slots + idx;
+		if(slot->dist != 0 && if_func(slot->key, slot->value, if_func_ctx) == true) {
+			la_hash_slot removed = *slot;
+			la_hash_remove_slot(h, idx);
+			la_hash_destroy_key(h, removed.key);
+			la_hash_destroy_value(h, removed.value);
+			num_keys_deleted++;
+			// Another entry might have been shifted into this slot - recheck it
+			continue;
 		}
+		idx = (idx + 1) & mask;
 	}
-	for(la_list *l = keys_to_delete; l != NULL; l = la_list_next(l)) {
-		la_hash_remove(h, l->data);
-	}
-	// can't use la_list_free() here, as keys have already been freed by la_hash_remove()
-	la_list_free_full(keys_to_delete, la_free_noop);
 	return num_keys_deleted;
 }
 
-// This is a callback for la_list_free_full_with_ctx()
-static void la_hash_element_destroy(void *elemptr, void *hashptr) {
-	la_assert(hashptr != NULL);
-	if(elemptr == NULL) {
-		return;
-	}
-	la_hash *h = hashptr;
-	la_hash_element *elem = elemptr;
-	la_hash_destroy_key(h, elem->key);
-	la_hash_destroy_value(h, elem->value);
-	LA_XFREE(elem);
-}
-
 // Deallocates all keys and values (if destroy functions have been provided)
 // and then frees the memory used by the hash.
 void la_hash_destroy(la_hash *h) {
 	if(h == NULL) {
 		return;
 	}
-	for(size_t i = 0; i < LA_HASH_SIZE; i++) {
-		la_list_free_full_with_ctx(h->buckets[i], la_hash_element_destroy, h);
-		h->buckets[i] = NULL;
+	for(size_t i = 0; i < h->capacity; i++) {
+		if(h->slots[i].dist != 0) {
+			la_hash_destroy_key(h, h->slots[i].key);
+			la_hash_destroy_value(h, h->slots[i].value);
+		}
 	}
+	LA_XFREE(h->slots);
 	LA_XFREE(h);
 }
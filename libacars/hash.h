@@ -7,6 +7,7 @@
 #define LA_HASH_H 1
 
 #include <stdbool.h>
+#include <stddef.h>         // size_t
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -23,8 +24,27 @@ typedef void (la_hash_value_destroy_func)(void *value);
 #define LA_HASH_INIT 5381
 #define LA_HASH_MULTIPLIER 17
 
+// Mixes a 64-bit word into hash value h. Useful for hashing keys made of
+// fixed-width integers, eg. strings packed into 64-bit words.
+static inline uint64_t la_hash_mix64(uint64_t h, uint64_t v) {
+	h ^= v;
+	h *= 0xbf58476d1ce4e5b9ULL;
+	h ^= h >> 31;
+	h *= 0x94d049bb133111ebULL;
+	h ^= h >> 29;
+	return h;
+}
+
+// Folds a 64-bit hash value into a value suitable for la_hash_func
+static inline uint32_t la_hash_fold64(uint64_t h) {
+	return (uint32_t)(h ^ (h >> 32));
+}
+
 la_hash *la_hash_new(la_hash_func *compute_hash, la_hash_compare_func *compare_keys,
 		la_hash_key_destroy_func *destroy_key, la_hash_value_destroy_func *destroy_value);
+la_hash *la_hash_new_sized(la_hash_func *compute_hash, la_hash_compare_func *compare_keys,
+		la_hash_key_destroy_func *destroy_key, la_hash_value_destroy_func *destroy_value,
+		size_t capacity_hint);
 bool la_hash_insert(la_hash *h, void *key, void *value);
 bool la_hash_remove(la_hash *h, void *key);
 void *la_hash_lookup(la_hash const *h, void const *key);
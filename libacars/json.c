@@ -4,13 +4,19 @@
  *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
  */
 
-#include <inttypes.h>                   // PRI* macros
 #include <stdbool.h>
 #include <stdint.h>
-#include <string.h>                     // strlen()
+#include <string.h>                     // memcpy(), strlen()
 #include <libacars/macros.h>            // la_assert()
-#include <libacars/vstring.h>           // la_vstring
+#include <libacars/vstring.h>           // la_vstring, la_vstring_append_*(), la_vstring_reserve()
 #include <libacars/util.h>              // LA_XCALLOC(), LA_XFREE()
+#include <libacars/arena.h>             // la_arena_activate()
+#include <libacars/json.h>              // la_json_key
+#include <libacars/sink-spill.h>        // la_sink_spill()
+
+// Long strings are escaped in chunks of this many bytes, so that the output
+// can be passed to the sink in parts (see la_sink_spill)
+#define LA_JSON_ESCAPE_CHUNK_LEN 4096
 
 static void la_json_trim_comma(la_vstring *vstr) {
 	la_assert(vstr != NULL);
@@ -21,63 +27,116 @@ static void la_json_trim_comma(la_vstring *vstr) {
 	}
 }
 
-// Note: this function escapes raw ASCII bytes. It does not assume that the input
-// is valid Unicode, so it does not attempt to guess Unicode codepoints from
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LA_JSON_ESCAPE_SSE2 1
+#include <emmintrin.h>                  // _mm_* SSE2 intrinsics
+#endif
+
+// Note: these functions escape raw ASCII bytes. They do not assume that the input
+// is valid Unicode, so they do not attempt to guess Unicode codepoints from
 // the input byte string.
-static char *la_json_escapechars(uint8_t const *buf, size_t len) {
-	la_assert(buf != NULL);
-	size_t new_len = len;
-	if(len > 0) {
-		for(size_t i = 0; i < len; i++) {
-			la_debug_print(D_INFO, "char: 0x%x\n", buf[i]);
-			if(buf[i] < ' ' || buf[i] > 0x7e || buf[i] == '\"' || buf[i] == '\\') {
-				la_debug_print(D_INFO, "char: 0x%x needs escaping\n", buf[i]);
-				new_len += 5;           // to fit the \uNNNN form
-			}
+static inline bool la_json_char_needs_escaping(uint8_t c) {
+	return c < ' ' || c > 0x7e || c == '\"' || c == '\\';
+}
+
+// Returns the length of the initial part of buf which does not need escaping
+static size_t la_json_plain_prefix_len(uint8_t const *buf, size_t len) {
+	size_t i = 0;
+#ifdef LA_JSON_ESCAPE_SSE2
+	// Bytes are compared as signed, so "less than space" also catches
+	// all bytes above 0x7f.
+	__m128i const space = _mm_set1_epi8(' ');
+	__m128i const del = _mm_set1_epi8(0x7f);
+	__m128i const quote = _mm_set1_epi8('\"');
+	__m128i const backslash = _mm_set1_epi8('\\');
+	for(; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128((__m128i const *)(buf + i));
+		__m128i special = _mm_or_si128(
+				_mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, del)),
+				_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)));
+		unsigned int mask = (unsigned int)_mm_movemask_epi8(special);
+		if(mask != 0) {
+#ifdef __GNUC__
+			return i + (size_t)__builtin_ctz(mask);
+#else
+			break;                      // locate it with the loop below
+#endif
 		}
 	}
-	char *out = LA_XCALLOC(new_len + 1, sizeof(uint8_t));   // Add space for NULL terminator
-	if(new_len == len) {
-		memcpy(out, buf, len);
-		goto end;
+#endif
+	while(i < len && !la_json_char_needs_escaping(buf[i])) {
+		i++;
+	}
+	return i;
+}
+
+// Writes the escaped form of c to out. Returns the number of bytes written (max 6).
+static size_t la_json_escape_char(char *out, uint8_t c) {
+	static char const hex[] = "0123456789abcdef";
+	out[0] = '\\';
+	switch(c) {
+		case '\b':
+			out[1] = 'b';
+			return 2;
+		case '\t':
+			out[1] = 't';
+			return 2;
+		case '\n':
+			out[1] = 'n';
+			return 2;
+		case '\f':
+			out[1] = 'f';
+			return 2;
+		case '\r':
+			out[1] = 'r';
+			return 2;
+		case '\"':
+			out[1] = '\"';
+			return 2;
+		case '\\':
+			out[1] = '\\';
+			return 2;
+		default:
+			out[1] = 'u';
+			out[2] = '0';
+			out[3] = '0';
+			out[4] = hex[c >> 4];
+			out[5] = hex[c & 0xf];
+			return 6;
 	}
-	char *outptr = out;
-	for(size_t i = 0; i < len; i++) {
-		if(buf[i] < ' ' || buf[i] > 0x7e || buf[i] == '\"' || buf[i] == '\\') {
-			*outptr++ = '\\';
-			switch(buf[i]) {
-				case '\b':
-					*outptr++ = 'b';
-					break;
-				case '\t':
-					*outptr++ = 't';
-					break;
-				case '\n':
-					*outptr++ = 'n';
-					break;
-				case '\f':
-					*outptr++ = 'f';
-					break;
-				case '\r':
-					*outptr++ = 'r';
-					break;
-				case '\"':
-					*outptr++ = '\"';
-					break;
-				case '\\':
-					*outptr++ = '\\';
-					break;
-				default:
-					sprintf(outptr, "u%04x", buf[i]);
-					outptr += 5;
-			}
-		} else {
-			*outptr++ = buf[i];
+}
+
+// Appends buf to vstr, escaping characters as necessary. Output is written
+// directly into the vstring buffer, which is grown only when escapes
+// make the result longer than the input.
+static void la_json_append_escaped_chunk(la_vstring *vstr, uint8_t const *buf, size_t len) {
+	la_vstring_reserve(vstr, len);
+	size_t i = 0;
+	while(i < len) {
+		size_t plain_len = la_json_plain_prefix_len(buf + i, len - i);
+		memcpy(vstr->str + vstr->len, buf + i, plain_len);
+		vstr->len += plain_len;
+		i += plain_len;
+		if(i < len) {
+			// Make room for the escape sequence and the rest of the input
+			la_vstring_reserve(vstr, 6 + len - i - 1);
+			vstr->len += la_json_escape_char(vstr->str + vstr->len, buf[i]);
+			i++;
 		}
 	}
-end:
-	out[new_len] = '\0';
-	return out;
+	vstr->str[vstr->len] = '\0';
+}
+
+// Escapes long strings in chunks, giving the sink (if any) a chance to take
+// the output in between
+static void la_json_append_escaped(la_vstring *vstr, uint8_t const *buf, size_t len) {
+	while(len > LA_JSON_ESCAPE_CHUNK_LEN) {
+		la_json_append_escaped_chunk(vstr, buf, LA_JSON_ESCAPE_CHUNK_LEN);
+		la_sink_spill(vstr);
+		buf += LA_JSON_ESCAPE_CHUNK_LEN;
+		len -= LA_JSON_ESCAPE_CHUNK_LEN;
+	}
+	la_json_append_escaped_chunk(vstr, buf, len);
 }
 
 static inline void la_json_print_key(la_vstring *vstr, char const *key) {
@@ -85,32 +144,77 @@ static inline void la_json_print_key(la_vstring *vstr, char const *key) {
 	if(key != NULL && key[0] != '\0') {
 		// Warning: no character escaping is performed here. For libacars this is fine
 		// as all key names are static. Escaping them would add unnecessary overhead.
-		la_vstring_append_sprintf(vstr, "\"%s\":", key);
+		size_t len = strlen(key);
+		la_vstring_reserve(vstr, len + 3);
+		char *ptr = vstr->str + vstr->len;
+		*ptr++ = '"';
+		memcpy(ptr, key, len);
+		ptr += len;
+		*ptr++ = '"';
+		*ptr++ = ':';
+		*ptr = '\0';
+		vstr->len += len + 3;
 	}
 }
 
-void la_json_append_bool(la_vstring *vstr, char const *key, bool val) {
+static inline void la_json_print_key_k(la_vstring *vstr, la_json_key const *key) {
 	la_assert(vstr != NULL);
+	if(key != NULL) {
+		la_vstring_append_buffer(vstr, key->str, key->len);
+	}
+}
+
+// Functions taking C string keys emit the key on their own and then
+// call their la_json_key counterparts with a NULL key.
+
+void la_json_append_bool_k(la_vstring *vstr, la_json_key const *key, bool val) {
+	la_json_print_key_k(vstr, key);
+	la_vstring_append_string(vstr, val == true ? "true," : "false,");
+}
+
+void la_json_append_bool(la_vstring *vstr, char const *key, bool val) {
 	la_json_print_key(vstr, key);
-	la_vstring_append_sprintf(vstr, "%s,", (val == true ? "true" : "false"));
+	la_json_append_bool_k(vstr, NULL, val);
+}
+
+void la_json_append_double_k(la_vstring *vstr, la_json_key const *key, double val) {
+	la_json_print_key_k(vstr, key);
+	la_vstring_append_double(vstr, val, 6);     // same as "%f"
+	la_vstring_append_char(vstr, ',');
 }
 
 void la_json_append_double(la_vstring *vstr, char const *key, double val) {
-	la_assert(vstr != NULL);
 	la_json_print_key(vstr, key);
-	la_vstring_append_sprintf(vstr, "%f,", val);
+	la_json_append_double_k(vstr, NULL, val);
+}
+
+void la_json_append_int64_k(la_vstring *vstr, la_json_key const *key, int64_t val) {
+	la_json_print_key_k(vstr, key);
+	la_vstring_append_int64(vstr, val);
+	la_vstring_append_char(vstr, ',');
 }
 
 void la_json_append_int64(la_vstring *vstr, char const *key, int64_t val) {
-	la_assert(vstr != NULL);
 	la_json_print_key(vstr, key);
-	la_vstring_append_sprintf(vstr, "%" PRId64 ",", val);
+	la_json_append_int64_k(vstr, NULL, val);
 }
 
 void la_json_append_long(la_vstring *vstr, char const *key, long val) {
 	la_json_append_int64(vstr, key, val);
 }
 
+void la_json_append_octet_string_as_string_k(la_vstring *vstr, la_json_key const *key,
+		uint8_t const *buf, size_t len) {
+	la_assert(vstr != NULL);
+	if(buf == NULL) {
+		return;
+	}
+	la_json_print_key_k(vstr, key);
+	la_vstring_append_char(vstr, '"');
+	la_json_append_escaped(vstr, buf, len);
+	la_vstring_append_buffer(vstr, "\",", 2);
+}
+
 void la_json_append_octet_string_as_string(la_vstring *vstr, char const *key,
 		uint8_t const *buf, size_t len) {
 	la_assert(vstr != NULL);
@@ -118,57 +222,101 @@ void la_json_append_octet_string_as_string(la_vstring *vstr, char const *key,
 		return;
 	}
 	la_json_print_key(vstr, key);
-	char *escaped = la_json_escapechars(buf, len);
-	la_vstring_append_sprintf(vstr, "\"%s\",", escaped);
-	LA_XFREE(escaped);
+	la_json_append_octet_string_as_string_k(vstr, NULL, buf, len);
 }
 
 // Note: this function does not handle NULL characters inside the string.
 // Whenever this might be an issue, la_json_append_octet_string_as_string shall be used instead.
+void la_json_append_string_k(la_vstring *vstr, la_json_key const *key, char const *val) {
+	la_json_append_octet_string_as_string_k(vstr, key, (uint8_t const *)val, strlen(val));
+}
+
 void la_json_append_string(la_vstring *vstr, char const *key, char const *val) {
 	la_json_append_octet_string_as_string(vstr, key, (uint8_t const *)val, strlen(val));
 }
 
+void la_json_append_char_k(la_vstring *vstr, la_json_key const *key, char val) {
+	la_json_append_octet_string_as_string_k(vstr, key, (uint8_t * const)&val, 1);
+}
+
 void la_json_append_char(la_vstring *vstr, char const *key, char val) {
 	la_json_append_octet_string_as_string(vstr, key, (uint8_t * const)&val, 1);
 }
 
+void la_json_object_start_k(la_vstring *vstr, la_json_key const *key) {
+	la_json_print_key_k(vstr, key);
+	la_vstring_append_char(vstr, '{');
+}
+
 void la_json_object_start(la_vstring *vstr, char const *key) {
-	la_assert(vstr != NULL);
 	la_json_print_key(vstr, key);
-	la_vstring_append_sprintf(vstr, "%s", "{");
+	la_json_object_start_k(vstr, NULL);
 }
 
 void la_json_object_end(la_vstring *vstr) {
 	la_assert(vstr != NULL);
 	la_json_trim_comma(vstr);
-	la_vstring_append_sprintf(vstr, "%s", "},");
+	la_vstring_append_buffer(vstr, "},", 2);
+}
+
+void la_json_array_start_k(la_vstring *vstr, la_json_key const *key) {
+	la_json_print_key_k(vstr, key);
+	la_vstring_append_char(vstr, '[');
 }
 
 void la_json_array_start(la_vstring *vstr, char const *key) {
-	la_assert(vstr != NULL);
 	la_json_print_key(vstr, key);
-	la_vstring_append_sprintf(vstr, "%s", "[");
+	la_json_array_start_k(vstr, NULL);
 }
 
 void la_json_array_end(la_vstring *vstr) {
 	la_assert(vstr != NULL);
 	la_json_trim_comma(vstr);
-	la_vstring_append_sprintf(vstr, "%s", "],");
+	la_vstring_append_buffer(vstr, "],", 2);
 }
 
-void la_json_append_octet_string(la_vstring *vstr, char const *key,
+void la_json_append_octet_string_k(la_vstring *vstr, la_json_key const *key,
 		uint8_t const *buf, size_t len) {
-	la_assert(vstr != NULL);
-	la_json_array_start(vstr, key);
+	la_json_array_start_k(vstr, key);
 	if(buf != NULL && len > 0) {
 		for(size_t i = 0; i < len; i++) {
-			la_json_append_long(vstr, NULL, buf[i]);
+			la_json_append_int64_k(vstr, NULL, buf[i]);
+			la_sink_spill(vstr);
 		}
 	}
 	la_json_array_end(vstr);
 }
 
+void la_json_append_octet_string(la_vstring *vstr, char const *key,
+		uint8_t const *buf, size_t len) {
+	la_json_print_key(vstr, key);
+	la_json_append_octet_string_k(vstr, NULL, buf, len);
+}
+
+la_json_key *la_json_key_new(char const *name) {
+	la_assert(name != NULL);
+	size_t len = strlen(name);
+	// Keys are meant to be long-lived, so never allocate them from the arena.
+	// The rendered key is stored in the same memory block, right after the struct.
+	la_arena *saved_arena = la_arena_activate(NULL);
+	la_json_key *key = LA_XCALLOC(1, sizeof(la_json_key) + len + 4);
+	la_arena_activate(saved_arena);
+	char *str = (char *)(key + 1);
+	if(len > 0) {                   // empty key is not printed, as in la_json_print_key
+		str[0] = '"';
+		memcpy(str + 1, name, len);
+		str[len + 1] = '"';
+		str[len + 2] = ':';
+		key->len = len + 3;
+	}
+	key->str = str;
+	return key;
+}
+
+void la_json_key_destroy(la_json_key *key) {
+	LA_XFREE(key);
+}
+
 void la_json_start(la_vstring *vstr) {
 	la_assert(vstr != NULL);
 	la_json_object_start(vstr, NULL);
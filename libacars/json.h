@@ -8,6 +8,7 @@
 #define LA_JSON_H 1
 
 #include <stdbool.h>
+#include <stddef.h>                     // size_t
 #include <stdint.h>
 #include <libacars/vstring.h>           // la_vstring
 
@@ -21,6 +22,20 @@ extern "C" {
 #define GCC_DEPRECATED(x)
 #endif
 
+// A JSON object key rendered in advance, complete with the quotes and the colon
+// (eg. "\"lat\":"), so that it can be emitted with a single memcpy.
+typedef struct {
+	char const *str;
+	size_t len;
+} la_json_key;
+
+// Renders a key from a string literal at compile time. Evaluates to a pointer
+// to la_json_key, suitable for passing to la_json_*_k() functions.
+// Uses a compound literal, hence it is not available in C++.
+#ifndef __cplusplus
+#define LA_JSON_KEY(k) (&(la_json_key const){ .str = "\"" k "\":", .len = sizeof("\"" k "\":") - 1 })
+#endif
+
 // json.c
 void la_json_object_start(la_vstring *vstr, char const *key);
 void la_json_object_end(la_vstring *vstr);
@@ -39,6 +54,19 @@ void la_json_append_octet_string_as_string(la_vstring *vstr, char const *key,
 		uint8_t const *buf, size_t len);
 void la_json_start(la_vstring *vstr);
 void la_json_end(la_vstring *vstr);
+void la_json_object_start_k(la_vstring *vstr, la_json_key const *key);
+void la_json_array_start_k(la_vstring *vstr, la_json_key const *key);
+void la_json_append_bool_k(la_vstring *vstr, la_json_key const *key, bool val);
+void la_json_append_double_k(la_vstring *vstr, la_json_key const *key, double val);
+void la_json_append_int64_k(la_vstring *vstr, la_json_key const *key, int64_t val);
+void la_json_append_char_k(la_vstring *vstr, la_json_key const *key, char val);
+void la_json_append_string_k(la_vstring *vstr, la_json_key const *key, char const *val);
+void la_json_append_octet_string_k(la_vstring *vstr, la_json_key const *key,
+		uint8_t const *buf, size_t len);
+void la_json_append_octet_string_as_string_k(la_vstring *vstr, la_json_key const *key,
+		uint8_t const *buf, size_t len);
+la_json_key *la_json_key_new(char const *name);
+void la_json_key_destroy(la_json_key *key);
 
 #ifdef __cplusplus
 }
@@ -4,13 +4,16 @@
  *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
  */
 #include <stdbool.h>
+#include <stdint.h>                 // uintptr_t
 #ifdef DEBUG
 #include <stdlib.h>                 // getenv, strtoul
 #endif
-#include <libacars/macros.h>        // la_assert
+#include <libacars/macros.h>        // la_assert, LA_THREAD_LOCAL
 #include <libacars/libacars.h>      // la_proto_node
-#include <libacars/vstring.h>
-#include <libacars/json.h>
+#include <libacars/vstring.h>       // la_vstring, la_vstring_pool_get
+#include <libacars/sink.h>          // la_sink
+#include <libacars/sink-spill.h>    // la_sink_write_vstring, la_sink_spill_start
+#include <libacars/json.h>          // la_json_*()
 #include <libacars/util.h>          // LA_XCALLOC, LA_XFREE
 
 static void la_proto_node_format_text(la_vstring *vstr, la_proto_node const *node, int indent) {
@@ -24,10 +27,20 @@ static void la_proto_node_format_text(la_vstring *vstr, la_proto_node const *nod
 	}
 }
 
+// Starts the JSON object of a protocol node. Uses the pre-rendered key, if the
+// type descriptor has one (types defined by applications might not).
+static void la_proto_node_json_object_start(la_vstring *vstr, la_type_descriptor const *td) {
+	if(td->json_key_k != NULL) {
+		la_json_object_start_k(vstr, td->json_key_k);
+	} else {
+		la_json_object_start(vstr, td->json_key);
+	}
+}
+
 static void la_proto_node_format_json(la_vstring *vstr, la_proto_node const *node) {
 	if(node->td != NULL) {
 		if(node->td->json_key != NULL) {
-			la_json_object_start(vstr, node->td->json_key);
+			la_proto_node_json_object_start(vstr, node->td);
 			// Missing JSON handler for a node is not fatal.
 			// In this case an empty JSON object is produced.
 			if(node->data != NULL && node->td->format_json != NULL) {
@@ -49,28 +62,128 @@ la_proto_node *la_proto_node_new() {
 	return node;
 }
 
+// Recently seen output lengths, per output format and per the type of the
+// innermost protocol node (which tells an ADS-C message from a CPDLC one,
+// while the root node is usually just ACARS). Used to preallocate output
+// vstrings of suitable size, so that they rarely need to grow.
+#define LA_FORMAT_SIZE_HINT_CNT 32
+
+typedef struct {
+	la_type_descriptor const *td;
+	size_t len;
+} la_format_size_hint;
+
+static LA_THREAD_LOCAL la_format_size_hint la_text_size_hints[LA_FORMAT_SIZE_HINT_CNT];
+static LA_THREAD_LOCAL la_format_size_hint la_json_size_hints[LA_FORMAT_SIZE_HINT_CNT];
+
+static la_format_size_hint *la_format_size_hint_lookup(la_format_size_hint *hints,
+		la_proto_node const *root) {
+	la_type_descriptor const *td = NULL;
+	for(la_proto_node const *node = root; node != NULL; node = node->next) {
+		if(node->td != NULL) {
+			td = node->td;
+		}
+	}
+	la_format_size_hint *hint = &hints[((uintptr_t)td >> 4) % LA_FORMAT_SIZE_HINT_CNT];
+	if(hint->td != td) {
+		hint->td = td;
+		hint->len = 0;
+	}
+	return hint;
+}
+
+static void la_format_size_hint_update(la_format_size_hint *hint, size_t len) {
+	// Decaying maximum - follows growth immediately and shrinks slowly
+	hint->len -= hint->len / 8;
+	if(len > hint->len) {
+		hint->len = len;
+	}
+}
+
 la_vstring *la_proto_tree_format_text(la_vstring *vstr, la_proto_node const *root) {
 	la_assert(root);
 
+	la_format_size_hint *hint = la_format_size_hint_lookup(la_text_size_hints, root);
 	if(vstr == NULL) {
-		vstr = la_vstring_new();
+		vstr = la_vstring_pool_get(hint->len);
 	}
+	size_t start = vstr->len;
 	la_proto_node_format_text(vstr, root, 0);
+	la_format_size_hint_update(hint, vstr->len - start);
 	return vstr;
 }
 
 la_vstring *la_proto_tree_format_json(la_vstring *vstr, la_proto_node const *root) {
 	la_assert(root);
 
+	la_format_size_hint *hint = la_format_size_hint_lookup(la_json_size_hints, root);
 	if(vstr == NULL) {
-		vstr = la_vstring_new();
+		vstr = la_vstring_pool_get(hint->len);
 	}
+	size_t start = vstr->len;
 	la_json_start(vstr);
 	la_proto_node_format_json(vstr, root);
 	la_json_end(vstr);
+	la_format_size_hint_update(hint, vstr->len - start);
 	return vstr;
 }
 
+// Produces the same output as la_proto_tree_format_text, but passes it
+// to the sink after each node. Long texts within a node (eg. message
+// bodies) are passed in parts, so that the amount of output held in memory
+// does not depend on the size of the message.
+int la_proto_tree_format_text_to_sink(la_sink *sink, la_proto_node const *root) {
+	la_assert(sink);
+	la_assert(root);
+
+	la_vstring *vstr = la_vstring_new();
+	la_sink_spill_start(sink, vstr, false);
+	int indent = 0, ret = 0;
+	for(la_proto_node const *node = root; node != NULL && ret == 0; node = node->next, indent++) {
+		if(node->data != NULL) {
+			la_assert(node->td);
+			node->td->format_text(vstr, node->data, indent);
+		}
+		ret = la_sink_write_vstring(sink, vstr, false);
+	}
+	la_sink_spill_stop();
+	la_vstring_destroy(vstr, true);
+	return ret;
+}
+
+// JSON counterpart of la_proto_tree_format_text_to_sink.
+// Objects started for each node are closed after the last node.
+int la_proto_tree_format_json_to_sink(la_sink *sink, la_proto_node const *root) {
+	la_assert(sink);
+	la_assert(root);
+
+	la_vstring *vstr = la_vstring_new();
+	la_sink_spill_start(sink, vstr, true);
+	int open_cnt = 0, ret = 0;
+	la_json_start(vstr);
+	for(la_proto_node const *node = root; node != NULL; node = node->next) {
+		if(node->td != NULL && node->td->json_key != NULL) {
+			la_proto_node_json_object_start(vstr, node->td);
+			if(node->data != NULL && node->td->format_json != NULL) {
+				node->td->format_json(vstr, node->data);
+			}
+			open_cnt++;
+		}
+		if((ret = la_sink_write_vstring(sink, vstr, true)) < 0) {
+			goto end;
+		}
+	}
+	while(open_cnt-- > 0) {
+		la_json_object_end(vstr);
+	}
+	la_json_end(vstr);
+	ret = la_sink_write_vstring(sink, vstr, false);
+end:
+	la_sink_spill_stop();
+	la_vstring_destroy(vstr, true);
+	return ret;
+}
+
 void la_proto_tree_destroy(la_proto_node *root) {
 	if(root == NULL) {
 		return;
@@ -9,6 +9,8 @@
 #include <stdbool.h>
 #include <libacars/version.h>
 #include <libacars/vstring.h>       // la_vstring
+#include <libacars/sink.h>          // la_sink
+#include <libacars/json.h>          // la_json_key
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,8 +31,8 @@ typedef struct {
 	la_destroy_type_f *destroy;
 	la_format_json_func *format_json;
 	char *json_key;
+	la_json_key const *json_key_k;  // json_key rendered with LA_JSON_KEY() (optional)
 // reserved for future use
-	void (*reserved2)(void);
 	void (*reserved3)(void);
 	void (*reserved4)(void);
 	void (*reserved5)(void);
@@ -42,6 +44,8 @@ typedef struct {
 
 typedef struct la_proto_node la_proto_node;
 
+typedef struct la_config_snapshot_s la_config_snapshot;
+
 struct la_proto_node {
 	la_type_descriptor const *td;
 	void *data;
@@ -57,6 +61,8 @@ struct la_proto_node {
 la_proto_node *la_proto_node_new();
 la_vstring *la_proto_tree_format_text(la_vstring *vstr, la_proto_node const *root);
 la_vstring *la_proto_tree_format_json(la_vstring *vstr, la_proto_node const *root);
+int la_proto_tree_format_text_to_sink(la_sink *sink, la_proto_node const *root);
+int la_proto_tree_format_json_to_sink(la_sink *sink, la_proto_node const *root);
 void la_proto_tree_destroy(la_proto_node *root);
 la_proto_node *la_proto_tree_find_protocol(la_proto_node *root, la_type_descriptor const *td);
 
@@ -72,8 +78,11 @@ bool la_config_get_int(char const *name, long int *result);
 bool la_config_get_double(char const *name, double *result);
 bool la_config_get_str(char const *name, char **result);
 bool la_config_unset(char *name);
-
-// configuration.c
+la_config_snapshot *la_config_snapshot_new();
+bool la_config_snapshot_set_bool(la_config_snapshot *snap, char const *name, bool value);
+bool la_config_snapshot_set_int(la_config_snapshot *snap, char const *name, long int value);
+void la_config_snapshot_destroy(la_config_snapshot *snap);
+la_config_snapshot const *la_config_snapshot_bind(la_config_snapshot const *snap);
 
 #ifdef __cplusplus
 }
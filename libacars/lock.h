@@ -0,0 +1,99 @@
+/*
+ *  This file is a part of libacars
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+
+#ifndef LA_LOCK_H
+#define LA_LOCK_H 1
+
+// Minimal portable mutex wrapper and atomic counters used by thread-safe
+// data structures (eg. sharded reassembly contexts)
+
+#include <stdint.h>                     // int64_t
+
+#ifdef _WIN32
+#include <windows.h>                    // SRWLOCK
+
+typedef SRWLOCK la_lock;
+
+static inline void la_lock_init(la_lock *lock) {
+	InitializeSRWLock(lock);
+}
+
+static inline void la_lock_acquire(la_lock *lock) {
+	AcquireSRWLockExclusive(lock);
+}
+
+static inline void la_lock_release(la_lock *lock) {
+	ReleaseSRWLockExclusive(lock);
+}
+
+static inline void la_lock_destroy(la_lock *lock) {
+	// SRW locks do not need to be destroyed
+	(void)lock;
+}
+
+// Adds val to *ptr atomically and returns the new value
+static inline int64_t la_atomic_add(int64_t volatile *ptr, int64_t val) {
+	return InterlockedExchangeAdd64((LONG64 volatile *)ptr, val) + val;
+}
+
+static inline int64_t la_atomic_load(int64_t volatile *ptr) {
+	return InterlockedCompareExchange64((LONG64 volatile *)ptr, 0, 0);
+}
+
+// Raises *ptr to val atomically, if it's lower
+static inline void la_atomic_max(int64_t volatile *ptr, int64_t val) {
+	LONG64 cur = InterlockedCompareExchange64((LONG64 volatile *)ptr, 0, 0);
+	while(cur < val) {
+		LONG64 prev = InterlockedCompareExchange64((LONG64 volatile *)ptr, val, cur);
+		if(prev == cur) {
+			break;
+		}
+		cur = prev;
+	}
+}
+
+#else
+#include <pthread.h>                    // pthread_mutex_*
+#include <libacars/macros.h>            // la_assert_se
+
+typedef pthread_mutex_t la_lock;
+
+static inline void la_lock_init(la_lock *lock) {
+	la_assert_se(pthread_mutex_init(lock, NULL) == 0);
+}
+
+static inline void la_lock_acquire(la_lock *lock) {
+	la_assert_se(pthread_mutex_lock(lock) == 0);
+}
+
+static inline void la_lock_release(la_lock *lock) {
+	la_assert_se(pthread_mutex_unlock(lock) == 0);
+}
+
+static inline void la_lock_destroy(la_lock *lock) {
+	(void)pthread_mutex_destroy(lock);
+}
+
+// Adds val to *ptr atomically and returns the new value
+static inline int64_t la_atomic_add(int64_t volatile *ptr, int64_t val) {
+	return __atomic_add_fetch(ptr, val, __ATOMIC_RELAXED);
+}
+
+static inline int64_t la_atomic_load(int64_t volatile *ptr) {
+	return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+}
+
+// Raises *ptr to val atomically, if it's lower
+static inline void la_atomic_max(int64_t volatile *ptr, int64_t val) {
+	int64_t cur = __atomic_load_n(ptr, __ATOMIC_RELAXED);
+	while(cur < val && !__atomic_compare_exchange_n(ptr, &cur, val, true,
+				__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		;
+}
+
+#endif // _WIN32
+
+#endif // !LA_LOCK_H
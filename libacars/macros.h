@@ -19,6 +19,14 @@
 #define LA_UNLIKELY(x) (x)
 #endif
 
+#if defined(_MSC_VER)
+#define LA_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define LA_THREAD_LOCAL __thread
+#else
+#define LA_THREAD_LOCAL _Thread_local
+#endif
+
 #ifdef __GNUC__
 #define LA_PRETTY_FUNCTION __PRETTY_FUNCTION__
 #else
@@ -48,6 +56,9 @@
 #ifdef DEBUG
 #include <stdint.h>
 
+// Debug level. Set once from LA_DEBUG environment variable by the library
+// constructor and never modified afterwards, so it is safe to read it from
+// multiple threads without synchronization.
 extern uint32_t Debug;
 
 // debug levels
@@ -12,7 +12,8 @@
 #include <libacars/macros.h>        // la_assert()
 #include <libacars/vstring.h>       // la_vstring, la_vstring_append_sprintf(), LA_ISPRINTF()
 #include <libacars/json.h>          // la_json_*()
-#include <libacars/util.h>          // LA_XCALLOC(), ATOI2()
+#include <libacars/util.h>          // LA_XCALLOC(), ATOI2(), la_arena_defer()
+#include <libacars/arena.h>         // la_arena_current()
 
 typedef struct {
 	char code;
@@ -43,6 +44,12 @@ bool is_valid_link(char link) {
 	return strchr("VSHGC2XI", link) != NULL;
 }
 
+static void la_media_adv_links_free(void *data) {
+	la_media_adv_msg *msg = data;
+	la_vstring_destroy(msg->available_links, true);
+	msg->available_links = NULL;
+}
+
 la_proto_node *la_media_adv_parse(char const *txt) {
 	if(txt == NULL) {
 		return NULL;
@@ -84,6 +91,12 @@ la_proto_node *la_media_adv_parse(char const *txt) {
 	}
 	txt += 9;
 	msg->available_links = la_vstring_new();
+	// la_vstring_new() never allocates from the arena, so the string has to
+	// be released separately when the arena is reset.
+	la_arena *arena = la_arena_current();
+	if(arena != NULL) {
+		la_arena_defer(arena, la_media_adv_links_free, msg);
+	}
 	// Copy all link until / character or end of string
 	for(; *txt != '/' && *txt != '\0'; txt++) {
 		if(is_valid_link(*txt)) {
@@ -93,7 +106,7 @@ la_proto_node *la_media_adv_parse(char const *txt) {
 		}
 	}
 	if(txt[0] == '/' && txt[1] != '\0') {
-		msg->text = strdup(txt + 1);
+		msg->text = LA_XSTRDUP(txt + 1);
 	}
 	msg->err = false;
 end:
@@ -143,33 +156,33 @@ void la_media_adv_format_json(la_vstring *vstr, void const *data) {
 
 	la_media_adv_msg const *msg = data;
 
-	la_json_append_bool(vstr, "err", msg->err);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("err"), msg->err);
 	if(msg->err == true) {
 		return;
 	}
-	la_json_append_int64(vstr, "version", msg->version);
-	la_json_object_start(vstr, "current_link");
-	la_json_append_char(vstr, "code", msg->current_link);
-	la_json_append_string(vstr, "descr", get_link_description(msg->current_link));
-	la_json_append_bool(vstr, "established", (msg->state == 'E') ? true : false);
-	la_json_object_start(vstr, "time");
-	la_json_append_int64(vstr, "hour", msg->hour);
-	la_json_append_int64(vstr, "min", msg->minute);
-	la_json_append_int64(vstr, "sec", msg->second);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("version"), msg->version);
+	la_json_object_start_k(vstr, LA_JSON_KEY("current_link"));
+	la_json_append_char_k(vstr, LA_JSON_KEY("code"), msg->current_link);
+	la_json_append_string_k(vstr, LA_JSON_KEY("descr"), get_link_description(msg->current_link));
+	la_json_append_bool_k(vstr, LA_JSON_KEY("established"), (msg->state == 'E') ? true : false);
+	la_json_object_start_k(vstr, LA_JSON_KEY("time"));
+	la_json_append_int64_k(vstr, LA_JSON_KEY("hour"), msg->hour);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("min"), msg->minute);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("sec"), msg->second);
 	la_json_object_end(vstr);
 	la_json_object_end(vstr);
 
-	la_json_array_start(vstr, "links_avail");
+	la_json_array_start_k(vstr, LA_JSON_KEY("links_avail"));
 	size_t count = strlen(msg->available_links->str);
 	for(size_t i = 0; i < count; i++) {
 		la_json_object_start(vstr, NULL);
-		la_json_append_char(vstr, "code", msg->available_links->str[i]);
-		la_json_append_string(vstr, "descr", get_link_description(msg->available_links->str[i]));
+		la_json_append_char_k(vstr, LA_JSON_KEY("code"), msg->available_links->str[i]);
+		la_json_append_string_k(vstr, LA_JSON_KEY("descr"), get_link_description(msg->available_links->str[i]));
 		la_json_object_end(vstr);
 	}
 	la_json_array_end(vstr);
 	if(msg->text != NULL && msg->text[0] != '\0') {
-		la_json_append_string(vstr, "text", msg->text);
+		la_json_append_string_k(vstr, LA_JSON_KEY("text"), msg->text);
 	}
 }
 
@@ -178,7 +191,7 @@ void la_media_adv_destroy(void *data) {
 		return;
 	}
 	la_media_adv_msg *msg = data;
-	la_vstring_destroy(msg->available_links, true);
+	la_media_adv_links_free(msg);
 	LA_XFREE(msg->text);
 	LA_XFREE(msg);
 }
@@ -187,6 +200,7 @@ la_type_descriptor const la_DEF_media_adv_message = {
 	.format_text = la_media_adv_format_text,
 	.format_json = la_media_adv_format_json,
 	.json_key = "media-adv",
+	.json_key_k = LA_JSON_KEY("media-adv"),
 	.destroy = la_media_adv_destroy
 };
 
@@ -13,6 +13,7 @@
 #endif
 #include <libacars/macros.h>        // la_assert(), LA_UNLIKELY()
 #include <libacars/libacars.h>      // la_proto_node
+#include <libacars/configuration.h> // la_config_current()
 #include <libacars/vstring.h>       // la_vstring, LA_ISPRINTF, la_isprintf_multiline_text()
 #include <libacars/json.h>          // la_json_append_*()
 #include <libacars/dict.h>          // la_dict, la_dict_search()
@@ -320,7 +321,7 @@ static void la_miam_errors_format_text(la_vstring *vstr, uint32_t err, int inden
 
 static void la_miam_errors_format_json(la_vstring *vstr, uint32_t err) {
 	la_assert(vstr != NULL);
-	la_json_append_int64(vstr, "err", err);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("err"), err);
 }
 
 static void la_miam_bitmask_format_text(la_vstring *vstr, uint8_t bitmask,
@@ -399,14 +400,14 @@ static void v1v2_alo_alr_format_json(la_vstring *vstr, void const *data,
 		la_miam_errors_format_json(vstr, pdu->err & LA_MIAM_ERR_HDR);
 		return;
 	}
-	la_json_append_int64(vstr, "pdu_len", pdu->pdu_len);
-	la_json_append_string(vstr, "aircraft_id", pdu->aircraft_id);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("pdu_len"), pdu->pdu_len);
+	la_json_append_string_k(vstr, LA_JSON_KEY("aircraft_id"), pdu->aircraft_id);
 	la_json_array_start(vstr,
 			pdu_type == LA_MIAM_CORE_PDU_ALO ? "comp_supported" : "comp_selected");
 	la_miam_bitmask_format_json(vstr, pdu->compression,
 			la_miam_core_v1v2_alo_alr_compression_names);
 	la_json_array_end(vstr);
-	la_json_array_start(vstr, "networks_supported");
+	la_json_array_start_k(vstr, LA_JSON_KEY("networks_supported"));
 	la_miam_bitmask_format_json(vstr, pdu->networks,
 			la_miam_core_v1v2_alo_alr_network_names);
 	la_json_array_end(vstr);
@@ -461,8 +462,8 @@ void la_miam_core_format_json(la_vstring *vstr, void const *data) {
 		la_miam_errors_format_json(vstr, pdu->err & LA_MIAM_ERR_HDR);
 		return;
 	}
-	la_json_append_int64(vstr, "version", pdu->version);
-	la_json_append_int64(vstr, "pdu_type", pdu->pdu_type);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("version"), pdu->version);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("pdu_type"), pdu->pdu_type);
 }
 
 // MIAM CORE v1/v2 common type descriptors
@@ -471,18 +472,21 @@ la_type_descriptor const la_DEF_miam_core_pdu = {
 	.format_text = la_miam_core_format_text,
 	.format_json = la_miam_core_format_json,
 	.json_key = "miam_core",
+	.json_key_k = LA_JSON_KEY("miam_core"),
 	.destroy = NULL
 };
 la_type_descriptor const la_DEF_miam_core_v1v2_alo_pdu = {
 	.format_text = la_miam_core_v1v2_alo_format_text,
 	.format_json = la_miam_core_v1v2_alo_format_json,
 	.json_key = "aloha",
+	.json_key_k = LA_JSON_KEY("aloha"),
 	.destroy = NULL
 };
 la_type_descriptor const la_DEF_miam_core_v1v2_alr_pdu = {
 	.format_text = la_miam_core_v1v2_alr_format_text,
 	.format_json = la_miam_core_v1v2_alr_format_json,
 	.json_key = "aloha_reply",
+	.json_key_k = LA_JSON_KEY("aloha_reply"),
 	.destroy = NULL
 };
 
@@ -741,7 +745,7 @@ static void la_miam_core_v1_data_format_text(la_vstring *vstr, void const *data,
 			// Parser has appended '\0' at the end, so it's safe to print it directly
 			bool prettify_xml = false;
 #ifdef WITH_LIBXML2
-			(void)la_config_get_bool("prettify_xml", &prettify_xml);
+			prettify_xml = la_config_current(NULL)->prettify_xml;
 			if(prettify_xml == true) {
 				xmlBufferPtr xmlbufptr = NULL;
 				if((xmlbufptr = la_prettify_xml((char *)pdu->data)) != NULL) {
@@ -781,46 +785,46 @@ static void la_miam_core_v1_data_format_json(la_vstring *vstr, void const *data)
 		la_miam_errors_format_json(vstr, pdu->err & LA_MIAM_ERR_HDR);
 		return;
 	}
-	la_json_append_int64(vstr, "pdu_len", pdu->pdu_len);
-	la_json_append_string(vstr, "aircraft_id", pdu->aircraft_id);
-	la_json_append_int64(vstr, "msg_num", pdu->msg_num);
-	la_json_append_bool(vstr, "ack_required", pdu->ack_option == 1 ? true : false);
-	la_json_append_int64(vstr, "compression", pdu->compression);
-	la_json_append_int64(vstr, "encoding", pdu->encoding);
-	la_json_append_int64(vstr, "app_type", pdu->app_type);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("pdu_len"), pdu->pdu_len);
+	la_json_append_string_k(vstr, LA_JSON_KEY("aircraft_id"), pdu->aircraft_id);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("msg_num"), pdu->msg_num);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("ack_required"), pdu->ack_option == 1 ? true : false);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("compression"), pdu->compression);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("encoding"), pdu->encoding);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("app_type"), pdu->app_type);
 
 	switch(pdu->app_type) {
 		case LA_MIAM_CORE_V1_APP_ACARS_2CHAR:
 		case LA_MIAM_CORE_V1_APP_ACARS_4CHAR:
 		case LA_MIAM_CORE_V1_APP_ACARS_6CHAR:
-			la_json_object_start(vstr, "acars");
-			la_json_append_string(vstr, "label",
+			la_json_object_start_k(vstr, LA_JSON_KEY("acars"));
+			la_json_append_string_k(vstr, LA_JSON_KEY("label"),
 					(char const *)(&((char[]){pdu->app_id[0], pdu->app_id[1], '\0'})));
 			if(pdu->app_type == LA_MIAM_CORE_V1_APP_ACARS_4CHAR ||
 					pdu->app_type == LA_MIAM_CORE_V1_APP_ACARS_6CHAR) {
-				la_json_append_string(vstr, "sublabel",
+				la_json_append_string_k(vstr, LA_JSON_KEY("sublabel"),
 						(char const *)(&((char[]){pdu->app_id[2], pdu->app_id[3], '\0'})));
 
 			}
 			if(pdu->app_type == LA_MIAM_CORE_V1_APP_ACARS_6CHAR) {
-				la_json_append_string(vstr, "mfi",
+				la_json_append_string_k(vstr, LA_JSON_KEY("mfi"),
 						(char const *)(&((char[]){pdu->app_id[4], pdu->app_id[5], '\0'})));
 			}
 			break;
 		case LA_MIAM_CORE_V1_APP_NONACARS_6CHAR:
-			la_json_object_start(vstr, "non_acars");
-			la_json_append_string(vstr, "app_id", pdu->app_id);
+			la_json_object_start_k(vstr, LA_JSON_KEY("non_acars"));
+			la_json_append_string_k(vstr, LA_JSON_KEY("app_id"), pdu->app_id);
 			break;
 		default:
-			la_json_object_start(vstr, "unknown_payload_type");
+			la_json_object_start_k(vstr, LA_JSON_KEY("unknown_payload_type"));
 			break;
 	}
-	la_json_object_start(vstr, "message");
+	la_json_object_start_k(vstr, LA_JSON_KEY("message"));
 	if(pdu->data != NULL) {
 		if(is_printable(pdu->data, pdu->data_len)) {
-			la_json_append_string(vstr, "text", (char *)pdu->data);
+			la_json_append_string_k(vstr, LA_JSON_KEY("text"), (char *)pdu->data);
 		} else {
-			la_json_append_octet_string(vstr, "octet_string",
+			la_json_append_octet_string_k(vstr, LA_JSON_KEY("octet_string"),
 					(uint8_t *)pdu->data, pdu->data_len);
 		}
 	}
@@ -871,10 +875,10 @@ static void la_miam_core_v1_ack_format_json(la_vstring *vstr, void const *data)
 		la_miam_errors_format_json(vstr, pdu->err & LA_MIAM_ERR_HDR);
 		return;
 	}
-	la_json_append_int64(vstr, "pdu_len", pdu->pdu_len);
-	la_json_append_string(vstr, "aircraft_id", pdu->aircraft_id);
-	la_json_append_int64(vstr, "msg_ack_num", pdu->msg_ack_num);
-	la_json_append_int64(vstr, "ack_xfer_result", pdu->ack_xfer_result);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("pdu_len"), pdu->pdu_len);
+	la_json_append_string_k(vstr, LA_JSON_KEY("aircraft_id"), pdu->aircraft_id);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("msg_ack_num"), pdu->msg_ack_num);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("ack_xfer_result"), pdu->ack_xfer_result);
 }
 
 // MIAM Core v1-specific destructors
@@ -894,12 +898,14 @@ la_type_descriptor const la_DEF_miam_core_v1_data_pdu = {
 	.format_text = la_miam_core_v1_data_format_text,
 	.format_json = la_miam_core_v1_data_format_json,
 	.json_key = "data",
+	.json_key_k = LA_JSON_KEY("data"),
 	.destroy = la_miam_core_v1_data_destroy
 };
 la_type_descriptor const la_DEF_miam_core_v1_ack_pdu = {
 	.format_text = la_miam_core_v1_ack_format_text,
 	.format_json = la_miam_core_v1_ack_format_json,
 	.json_key = "ack",
+	.json_key_k = LA_JSON_KEY("ack"),
 	.destroy = NULL
 };
 
@@ -1142,7 +1148,7 @@ static void la_miam_core_v2_data_format_text(la_vstring *vstr, void const *data,
 			// Parser has appended '\0' at the end, so it's safe to print it directly
 			bool prettify_xml = false;
 #ifdef WITH_LIBXML2
-			(void)la_config_get_bool("prettify_xml", &prettify_xml);
+			prettify_xml = la_config_current(NULL)->prettify_xml;
 			if(prettify_xml == true) {
 				xmlBufferPtr xmlbufptr = NULL;
 				if((xmlbufptr = la_prettify_xml((char *)pdu->data)) != NULL) {
@@ -1182,27 +1188,27 @@ static void la_miam_core_v2_data_format_json(la_vstring *vstr, void const *data)
 		la_miam_errors_format_json(vstr, pdu->err & LA_MIAM_ERR_HDR);
 		return;
 	}
-	la_json_append_int64(vstr, "msg_num", pdu->msg_num);
-	la_json_append_bool(vstr, "ack_required", pdu->ack_option == 1 ? true : false);
-	la_json_append_int64(vstr, "compression", pdu->compression);
-	la_json_append_int64(vstr, "encoding", pdu->encoding);
-	la_json_append_int64(vstr, "app_type", pdu->app_type);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("msg_num"), pdu->msg_num);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("ack_required"), pdu->ack_option == 1 ? true : false);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("compression"), pdu->compression);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("encoding"), pdu->encoding);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("app_type"), pdu->app_type);
 
 	switch(pdu->app_type) {
 		case LA_MIAM_CORE_V2_APP_ACARS_2CHAR:
 		case LA_MIAM_CORE_V2_APP_ACARS_4CHAR:
 		case LA_MIAM_CORE_V2_APP_ACARS_6CHAR:
-			la_json_object_start(vstr, "acars");
-			la_json_append_string(vstr, "label",
+			la_json_object_start_k(vstr, LA_JSON_KEY("acars"));
+			la_json_append_string_k(vstr, LA_JSON_KEY("label"),
 					(char const *)(&((char[]){pdu->app_id[0], pdu->app_id[1], '\0'})));
 			if(pdu->app_type == LA_MIAM_CORE_V2_APP_ACARS_4CHAR ||
 					pdu->app_type == LA_MIAM_CORE_V2_APP_ACARS_6CHAR) {
-				la_json_append_string(vstr, "sublabel",
+				la_json_append_string_k(vstr, LA_JSON_KEY("sublabel"),
 						(char const *)(&((char[]){pdu->app_id[2], pdu->app_id[3], '\0'})));
 
 			}
 			if(pdu->app_type == LA_MIAM_CORE_V2_APP_ACARS_6CHAR) {
-				la_json_append_string(vstr, "mfi",
+				la_json_append_string_k(vstr, LA_JSON_KEY("mfi"),
 						(char const *)(&((char[]){pdu->app_id[4], pdu->app_id[5], '\0'})));
 			}
 			break;
@@ -1215,16 +1221,16 @@ static void la_miam_core_v2_data_format_json(la_vstring *vstr, void const *data)
 			break;
 		case LA_MIAM_CORE_V2_APP_NONACARS_6CHAR:
 		default:    // including 0x8-0x15
-			la_json_object_start(vstr, "non_acars");
-			la_json_append_string(vstr, "app_id", pdu->app_id);
+			la_json_object_start_k(vstr, LA_JSON_KEY("non_acars"));
+			la_json_append_string_k(vstr, LA_JSON_KEY("app_id"), pdu->app_id);
 			break;
 	}
-	la_json_object_start(vstr, "message");
+	la_json_object_start_k(vstr, LA_JSON_KEY("message"));
 	if(pdu->data != NULL) {
 		if(is_printable(pdu->data, pdu->data_len)) {
-			la_json_append_string(vstr, "text", (char *)pdu->data);
+			la_json_append_string_k(vstr, LA_JSON_KEY("text"), (char *)pdu->data);
 		} else {
-			la_json_append_octet_string(vstr, "octet_string",
+			la_json_append_octet_string_k(vstr, LA_JSON_KEY("octet_string"),
 					(uint8_t *)pdu->data, pdu->data_len);
 		}
 	}
@@ -1274,8 +1280,8 @@ static void la_miam_core_v2_ack_format_json(la_vstring *vstr, void const *data)
 		la_miam_errors_format_json(vstr, pdu->err & LA_MIAM_ERR_HDR);
 		return;
 	}
-	la_json_append_int64(vstr, "msg_ack_num", pdu->msg_ack_num);
-	la_json_append_int64(vstr, "ack_xfer_result", pdu->ack_xfer_result);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("msg_ack_num"), pdu->msg_ack_num);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("ack_xfer_result"), pdu->ack_xfer_result);
 }
 
 // MIAM CORE v2-specific destructors
@@ -1295,11 +1301,13 @@ la_type_descriptor const la_DEF_miam_core_v2_data_pdu = {
 	.format_text = la_miam_core_v2_data_format_text,
 	.format_json = la_miam_core_v2_data_format_json,
 	.json_key = "data",
+	.json_key_k = LA_JSON_KEY("data"),
 	.destroy = &la_miam_core_v2_data_destroy
 };
 la_type_descriptor const la_DEF_miam_core_v2_ack_pdu = {
 	.format_text = la_miam_core_v2_ack_format_text,
 	.format_json = la_miam_core_v2_ack_format_json,
 	.json_key = "ack",
+	.json_key_k = LA_JSON_KEY("ack"),
 	.destroy = NULL
 };
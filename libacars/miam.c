@@ -16,9 +16,11 @@
 #include <libacars/libacars.h>      /* la_proto_node, la_type_descriptor */
 #include <libacars/vstring.h>       /* la_vstring */
 #include <libacars/json.h>          /* la_json_append_*() */
-#include <libacars/util.h>          /* la_strntouint16_t(), la_simple_strptime() */
+#include <libacars/util.h>          /* la_strntouint16_t(), la_simple_strptime(), la_strpack() */
 #include <libacars/dict.h>          /* la_dict, la_dict_search() */
 #include <libacars/reassembly.h>
+#include <libacars/configuration.h> /* la_config_current() */
+#include <libacars/reassembly-builtin.h>    /* la_miam_file_reasm_table_get() */
 #include <libacars/miam-core.h>     /* la_miam_core_pdu_parse(), la_miam_core_format_*() */
 #include <libacars/miam.h>
 
@@ -64,42 +66,116 @@ static struct timeval const la_miam_file_reasm_timeout = {
 	.tv_usec = 0
 };
 
+// Message info passed to the reassembly engine
 typedef struct {
-	char *reg;
+	char const *reg;
 	uint16_t file_id;
+} la_miam_file_msg_info;
+
+// MIAM file reassembly key. Registration and file ID are packed into two
+// 64-bit words, so that keys can be compared with two integer comparisons.
+// Registrations which do not fit in the packed field (ie. not coming from
+// ACARS) are additionally stored in full in long_reg. The hash of the key is
+// computed once, when the key is built.
+typedef struct {
+	union {
+		struct {
+			char reg[8];
+			uint16_t file_id;
+			char pad[6];
+		} f;
+		uint64_t w[2];
+	} packed;
+	uint64_t hash;
+	char *long_reg;
 } la_miam_file_key;
 
 static uint32_t la_miam_file_key_hash(void const *key) {
 	la_miam_file_key const *k = key;
-	uint32_t h = la_hash_string(k->reg, LA_HASH_INIT);
-	h += k->file_id;
-	return h;
+	return la_hash_fold64(k->hash);
 }
 
 static bool la_miam_file_key_compare(void const *key1, void const *key2) {
 	la_miam_file_key const *k1 = key1;
 	la_miam_file_key const *k2 = key2;
-	return (!strcmp(k1->reg, k2->reg) &&
-			(k1->file_id == k2->file_id));
+	if(k1->packed.w[0] != k2->packed.w[0] || k1->packed.w[1] != k2->packed.w[1]) {
+		return false;
+	}
+	if(k1->long_reg == NULL || k2->long_reg == NULL) {
+		return k1->long_reg == k2->long_reg;
+	}
+	return !strcmp(k1->long_reg, k2->long_reg);
+}
+
+static void la_miam_file_key_hash_compute(la_miam_file_key *key) {
+	key->hash = la_hash_mix64(la_hash_mix64(LA_HASH_INIT, key->packed.w[0]), key->packed.w[1]);
+	if(key->long_reg != NULL) {
+		key->hash = la_hash_mix64(key->hash, la_hash_string(key->long_reg, LA_HASH_INIT));
+	}
+}
+
+static void la_miam_file_tmp_key_fill(void *keyptr, void const *msg_info) {
+	la_assert(keyptr != NULL);
+	la_assert(msg_info != NULL);
+	la_miam_file_msg_info const *msg = msg_info;
+	la_miam_file_key *key = keyptr;
+	memset(&key->packed, 0, sizeof(key->packed));
+	la_strpack(key->packed.f.reg, msg->reg, sizeof(key->packed.f.reg));
+	key->packed.f.file_id = msg->file_id;
+	key->long_reg = NULL;
+	if(strlen(msg->reg) > sizeof(key->packed.f.reg)) {
+		key->long_reg = (char *)msg->reg;
+	}
+	la_miam_file_key_hash_compute(key);
 }
 
 static void *la_miam_file_key_get(void const *msg_info) {
 	la_assert(msg_info != NULL);
-	la_miam_file_key const *msg = msg_info;
 	LA_NEW(la_miam_file_key, key);
-	key->reg = strdup(msg->reg);
-	key->file_id = msg->file_id;
-	la_debug_print(D_INFO, "ALLOC KEY %s %d\n", key->reg, key->file_id);
+	la_miam_file_tmp_key_fill(key, msg_info);
+	if(key->long_reg != NULL) {
+		key->long_reg = strdup(key->long_reg);
+	}
+	la_debug_print(D_INFO, "ALLOC KEY %.8s %d\n", key->packed.f.reg, key->packed.f.file_id);
 	return (void *)key;
 }
 
-static void *la_miam_file_tmp_key_get(void const *msg_info) {
-	la_assert(msg_info != NULL);
-	la_miam_file_key const *msg = msg_info;
+// Serialized key format: packed registration (8 bytes), file ID (2 bytes,
+// big endian), followed by the full registration, if it didn't fit.
+static size_t la_miam_file_key_serialize(void const *keyptr, uint8_t *buf, size_t len) {
+	la_assert(keyptr != NULL);
+	la_miam_file_key const *key = keyptr;
+	size_t reg_len = sizeof(key->packed.f.reg);
+	size_t long_reg_len = key->long_reg != NULL ? strlen(key->long_reg) : 0;
+	size_t needed = reg_len + 2 + long_reg_len;
+	if(len >= needed) {
+		memcpy(buf, key->packed.f.reg, reg_len);
+		buf[reg_len] = key->packed.f.file_id >> 8;
+		buf[reg_len + 1] = key->packed.f.file_id & 0xff;
+		if(long_reg_len > 0) {
+			memcpy(buf + reg_len + 2, key->long_reg, long_reg_len);
+		}
+	}
+	return needed;
+}
+
+static void *la_miam_file_key_deserialize(uint8_t const *buf, size_t len) {
+	la_assert(buf != NULL);
+	size_t reg_len = sizeof(((la_miam_file_key *)NULL)->packed.f.reg);
+	size_t long_reg_len = len >= reg_len + 2 ? len - (reg_len + 2) : 0;
+	// Full registration is only present if it's too long for the packed field
+	if(len < reg_len + 2 || (long_reg_len > 0 && long_reg_len <= reg_len)) {
+		return NULL;
+	}
 	LA_NEW(la_miam_file_key, key);
-	key->reg = (char *)msg->reg;
-	key->file_id = msg->file_id;
-	return (void *)key;
+	memcpy(key->packed.f.reg, buf, reg_len);
+	key->packed.f.file_id = (uint16_t)(buf[reg_len] << 8 | buf[reg_len + 1]);
+	if(long_reg_len > 0) {
+		key->long_reg = LA_XCALLOC(long_reg_len + 1, sizeof(char));
+		memcpy(key->long_reg, buf + reg_len + 2, long_reg_len);
+	}
+	la_miam_file_key_hash_compute(key);
+	return key;
 }
 
 static void la_miam_file_key_destroy(void *ptr) {
@@ -107,19 +183,32 @@ static void la_miam_file_key_destroy(void *ptr) {
 		return;
 	}
 	la_miam_file_key *key = ptr;
-	la_debug_print(D_INFO, "DESTROY KEY %s %d\n", key->reg, key->file_id);
-	LA_XFREE(key->reg);
+	la_debug_print(D_INFO, "DESTROY KEY %.8s %d\n", key->packed.f.reg, key->packed.f.file_id);
+	LA_XFREE(key->long_reg);
 	LA_XFREE(key);
 }
 
-static la_reasm_table_funcs miam_file_reasm_funcs = {
+static la_reasm_table_funcs_ex miam_file_reasm_funcs = {
 	.get_key = la_miam_file_key_get,
-	.get_tmp_key = la_miam_file_tmp_key_get,
+	.fill_tmp_key = la_miam_file_tmp_key_fill,
+	.tmp_key_size = sizeof(la_miam_file_key),
 	.hash_key = la_miam_file_key_hash,
 	.compare_keys = la_miam_file_key_compare,
-	.destroy_key = la_miam_file_key_destroy
+	.destroy_key = la_miam_file_key_destroy,
+	.name = "miam_file",
+	.serialize_key = la_miam_file_key_serialize,
+	.deserialize_key = la_miam_file_key_deserialize
 };
 
+la_reasm_table *la_miam_file_reasm_table_get(la_reasm_ctx *rctx) {
+	la_reasm_table *rtable = la_reasm_table_lookup(rctx, &la_DEF_miam_file_segment_message);
+	if(rtable == NULL) {
+		rtable = la_reasm_table_new_ex(rctx, &la_DEF_miam_file_segment_message,
+				miam_file_reasm_funcs, LA_MIAM_FILE_REASM_TABLE_CLEANUP_INTERVAL);
+	}
+	return rtable;
+}
+
 /********************************************************************************
  * MIAM frame parsers
  ********************************************************************************/
@@ -175,33 +264,28 @@ static la_proto_node *la_miam_file_transfer_request_parse(char const *reg, char
 	// entry for this transfer now, because File Segment frames do not contain
 	// all necessary state information (file size, in particular).
 	if(rtables != NULL && reg != NULL) {
-		la_reasm_table *miam_file_table = la_reasm_table_lookup(rtables,
-				&la_DEF_miam_file_segment_message);
-		if(miam_file_table == NULL) {
-			miam_file_table = la_reasm_table_new(rtables,
-					&la_DEF_miam_file_segment_message, miam_file_reasm_funcs,
-					LA_MIAM_FILE_REASM_TABLE_CLEANUP_INTERVAL);
-		}
+		la_reasm_table *miam_file_table = la_miam_file_reasm_table_get(rtables);
 		// Add the initial empty fragment to the table.
 		// Can't use msg as msg_info directly, because we will be adding subsequent
 		// fragments from la_miam_file_segment_parse(), where the type of msg is
 		// different.
 		msg->reasm_status = la_reasm_fragment_add(miam_file_table,
 				&(la_reasm_fragment_info){
-					.msg_info = &(la_miam_file_key){
-						.reg = (char *)reg,
+					.msg_info = &(la_miam_file_msg_info){
+						.reg = reg,
 						.file_id = msg->file_id
 					},
 					.msg_data = NULL,       // payload will start in the next segment
 					.msg_data_len = 0,
 					.total_pdu_len = msg->file_size,
 					.total_fragment_cnt = 0, // not used here
-					.seq_num = 0,           // in sequence with file segment numbers, which go from 1
+					.seq_num = 0,           // precedes file segment numbers, which go from 1
 					.seq_num_first = 0,
 					.seq_num_wrap = SEQ_WRAP_NONE,
 					.is_final_fragment = false,
 					.rx_time = rx_time,
-					.reasm_timeout = la_miam_file_reasm_timeout
+					.reasm_timeout = la_miam_file_reasm_timeout,
+					.flags = LA_ALLOW_OUT_OF_ORDER_DELIVERY | LA_REQUIRE_FIRST_FRAGMENT
 				});
 	}
 	return node;
@@ -290,19 +374,14 @@ static la_proto_node *la_miam_file_segment_parse(char const *reg, char const *tx
 	// Can't use msg as msg_info directly in la_reasm_fragment_info, because the
 	// initial fragment is added by la_miam_file_transfer_request_parse(), where
 	// the type of msg is different.
-	la_miam_file_key msg_key = {
-		.reg = (char *)reg,
+	la_miam_file_msg_info msg_key = {
+		.reg = reg,
 		.file_id = msg->file_id
 	};
 	la_reasm_table *miam_file_table = NULL;
 
 	if(rtables != NULL && reg != NULL) {
-		miam_file_table = la_reasm_table_lookup(rtables, &la_DEF_miam_file_segment_message);
-		if(miam_file_table == NULL) {
-			miam_file_table = la_reasm_table_new(rtables,
-					&la_DEF_miam_file_segment_message, miam_file_reasm_funcs,
-					LA_MIAM_FILE_REASM_TABLE_CLEANUP_INTERVAL);
-		}
+		miam_file_table = la_miam_file_reasm_table_get(rtables);
 		// Add the fragment to the table.
 		msg->reasm_status = la_reasm_fragment_add(miam_file_table,
 				&(la_reasm_fragment_info){
@@ -316,7 +395,8 @@ static la_proto_node *la_miam_file_segment_parse(char const *reg, char const *tx
 					.seq_num_wrap = SEQ_WRAP_NONE,
 					.is_final_fragment = false, // not used here
 					.rx_time = rx_time,
-					.reasm_timeout = la_miam_file_reasm_timeout
+					.reasm_timeout = la_miam_file_reasm_timeout,
+					.flags = LA_ALLOW_OUT_OF_ORDER_DELIVERY | LA_REQUIRE_FIRST_FRAGMENT
 				});
 	}
 
@@ -336,7 +416,7 @@ static la_proto_node *la_miam_file_segment_parse(char const *reg, char const *tx
 	// or not.
 	if(rtables != NULL && (msg->reasm_status == LA_REASM_IN_PROGRESS ||
 				msg->reasm_status == LA_REASM_DUPLICATE)) {
-		(void)la_config_get_bool("decode_fragments", &decode_payload);
+		decode_payload = la_config_current(rtables)->decode_fragments;
 	}
 	if(decode_payload) {
 		node->next = la_miam_core_pdu_parse(txt);
@@ -569,19 +649,19 @@ static void la_miam_file_transfer_request_format_json(la_vstring *vstr, void con
 	la_assert(data);
 
 	la_miam_file_transfer_request_msg const *msg = data;
-	la_json_append_int64(vstr, "file_id", msg->file_id);
-	la_json_append_int64(vstr, "file_size", msg->file_size);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("file_id"), msg->file_id);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("file_size"), msg->file_size);
 	struct tm const *t = &msg->validity_time;
-	la_json_object_start(vstr, "complete_until_datetime");
-	la_json_object_start(vstr, "date");
-	la_json_append_int64(vstr, "year", t->tm_year + 1900);
-	la_json_append_int64(vstr, "month", t->tm_mon + 1);
-	la_json_append_int64(vstr, "day", t->tm_mday);
+	la_json_object_start_k(vstr, LA_JSON_KEY("complete_until_datetime"));
+	la_json_object_start_k(vstr, LA_JSON_KEY("date"));
+	la_json_append_int64_k(vstr, LA_JSON_KEY("year"), t->tm_year + 1900);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("month"), t->tm_mon + 1);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("day"), t->tm_mday);
 	la_json_object_end(vstr);
-	la_json_object_start(vstr, "time");
-	la_json_append_int64(vstr, "hour", t->tm_hour);
-	la_json_append_int64(vstr, "minute", t->tm_min);
-	la_json_append_int64(vstr, "second", t->tm_sec);
+	la_json_object_start_k(vstr, LA_JSON_KEY("time"));
+	la_json_append_int64_k(vstr, LA_JSON_KEY("hour"), t->tm_hour);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("minute"), t->tm_min);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("second"), t->tm_sec);
 	la_json_object_end(vstr);
 	la_json_object_end(vstr);
 }
@@ -604,10 +684,10 @@ static void la_miam_file_transfer_accept_format_json(la_vstring *vstr, void cons
 	la_assert(data);
 
 	la_miam_file_transfer_accept_msg const *msg = data;
-	la_json_append_int64(vstr, "file_id", msg->file_id);
-	la_json_append_int64(vstr, "segment_size", msg->segment_size);
-	la_json_append_int64(vstr, "on_ground_seg_temp_secs", msg->onground_segment_tempo);
-	la_json_append_int64(vstr, "in_flight_seg_temp_secs", msg->inflight_segment_tempo);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("file_id"), msg->file_id);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("segment_size"), msg->segment_size);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("on_ground_seg_temp_secs"), msg->onground_segment_tempo);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("in_flight_seg_temp_secs"), msg->inflight_segment_tempo);
 }
 
 static void la_miam_file_segment_format_text(la_vstring *vstr, void const *data, int indent) {
@@ -627,8 +707,8 @@ static void la_miam_file_segment_format_json(la_vstring *vstr, void const *data)
 	la_assert(data);
 
 	la_miam_file_segment_msg const *msg = data;
-	la_json_append_int64(vstr, "file_id", msg->file_id);
-	la_json_append_int64(vstr, "segment_id", msg->segment_id);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("file_id"), msg->file_id);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("segment_id"), msg->segment_id);
 }
 
 static void la_miam_file_transfer_abort_format_text(la_vstring *vstr, void const *data, int indent) {
@@ -657,8 +737,8 @@ static void la_miam_file_transfer_abort_format_json(la_vstring *vstr, void const
 	la_assert(data);
 
 	la_miam_file_transfer_abort_msg const *msg = data;
-	la_json_append_int64(vstr, "file_id", msg->file_id);
-	la_json_append_int64(vstr, "reason", msg->reason);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("file_id"), msg->file_id);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("reason"), msg->reason);
 }
 
 static void la_miam_xoff_ind_format_text(la_vstring *vstr, void const *data, int indent) {
@@ -680,9 +760,9 @@ static void la_miam_xoff_ind_format_json(la_vstring *vstr, void const *data) {
 	la_assert(data);
 
 	la_miam_xoff_ind_msg const *msg = data;
-	la_json_append_bool(vstr, "all_files", msg->file_id == 0xFFF);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("all_files"), msg->file_id == 0xFFF);
 	if(msg->file_id != 0xFFF) {
-		la_json_append_int64(vstr, "file_id", msg->file_id);
+		la_json_append_int64_k(vstr, LA_JSON_KEY("file_id"), msg->file_id);
 	}
 }
 
@@ -707,12 +787,12 @@ static void la_miam_xon_ind_format_json(la_vstring *vstr, void const *data) {
 	la_assert(data);
 
 	la_miam_xon_ind_msg const *msg = data;
-	la_json_append_bool(vstr, "all_files", msg->file_id == 0xFFF);
+	la_json_append_bool_k(vstr, LA_JSON_KEY("all_files"), msg->file_id == 0xFFF);
 	if(msg->file_id != 0xFFF) {
-		la_json_append_int64(vstr, "file_id", msg->file_id);
+		la_json_append_int64_k(vstr, LA_JSON_KEY("file_id"), msg->file_id);
 	}
-	la_json_append_int64(vstr, "on_ground_seg_temp_secs", msg->onground_segment_tempo);
-	la_json_append_int64(vstr, "in_flight_seg_temp_secs", msg->inflight_segment_tempo);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("on_ground_seg_temp_secs"), msg->onground_segment_tempo);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("in_flight_seg_temp_secs"), msg->inflight_segment_tempo);
 }
 
 void la_miam_format_text(la_vstring *vstr, void const *data, int indent) {
@@ -737,6 +817,7 @@ la_type_descriptor const la_DEF_miam_message = {
 	.format_text = la_miam_format_text,
 	.format_json = la_miam_format_json,
 	.json_key = "miam",
+	.json_key_k = LA_JSON_KEY("miam"),
 	.destroy = NULL
 };
 
@@ -744,6 +825,7 @@ la_type_descriptor const la_DEF_miam_single_transfer_message = {
 	.format_text = la_miam_single_transfer_format_text,
 	.format_json = la_miam_single_transfer_format_json,
 	.json_key = "single_transfer",
+	.json_key_k = LA_JSON_KEY("single_transfer"),
 	.destroy = NULL
 };
 
@@ -751,6 +833,7 @@ la_type_descriptor const la_DEF_miam_file_transfer_request_message = {
 	.format_text = la_miam_file_transfer_request_format_text,
 	.format_json = la_miam_file_transfer_request_format_json,
 	.json_key = "file_transfer_request",
+	.json_key_k = LA_JSON_KEY("file_transfer_request"),
 	.destroy = NULL
 };
 
@@ -758,6 +841,7 @@ la_type_descriptor const la_DEF_miam_file_transfer_accept_message = {
 	.format_text = la_miam_file_transfer_accept_format_text,
 	.format_json = la_miam_file_transfer_accept_format_json,
 	.json_key = "file_transfer_accept",
+	.json_key_k = LA_JSON_KEY("file_transfer_accept"),
 	.destroy = NULL
 };
 
@@ -765,6 +849,7 @@ la_type_descriptor const la_DEF_miam_file_segment_message = {
 	.format_text = la_miam_file_segment_format_text,
 	.format_json = la_miam_file_segment_format_json,
 	.json_key = "file_segment",
+	.json_key_k = LA_JSON_KEY("file_segment"),
 	.destroy = la_miam_file_segment_destroy
 };
 
@@ -772,6 +857,7 @@ la_type_descriptor const la_DEF_miam_file_transfer_abort_message = {
 	.format_text = la_miam_file_transfer_abort_format_text,
 	.format_json = la_miam_file_transfer_abort_format_json,
 	.json_key = "file_transfer_abort",
+	.json_key_k = LA_JSON_KEY("file_transfer_abort"),
 	.destroy = NULL
 };
 
@@ -779,6 +865,7 @@ la_type_descriptor const la_DEF_miam_xoff_ind_message = {
 	.format_text = la_miam_xoff_ind_format_text,
 	.format_json = la_miam_xoff_ind_format_json,
 	.json_key = "file_xoff_ind",
+	.json_key_k = LA_JSON_KEY("file_xoff_ind"),
 	.destroy = NULL
 };
 
@@ -786,6 +873,7 @@ la_type_descriptor const la_DEF_miam_xon_ind_message = {
 	.format_text = la_miam_xon_ind_format_text,
 	.format_json = la_miam_xon_ind_format_json,
 	.json_key = "file_xon_ind",
+	.json_key_k = LA_JSON_KEY("file_xon_ind"),
 	.destroy = NULL
 };
 
@@ -20,6 +20,7 @@
 #include <libacars/macros.h>        // la_debug_print()
 #include <libacars/json.h>          // ja_json_*
 #include <libacars/ohma.h>          // la_ohma_msg
+#include <libacars/reassembly-builtin.h>    // la_ohma_reasm_table_get()
 
 /********************************************************************************
  * OHMA reassembly constants and callbacks
@@ -35,21 +36,30 @@ static struct timeval const la_ohma_reasm_timeout = {
 	.tv_usec = 0
 };
 
+// OHMA reassembly key. Conversation IDs are of arbitrary length, so the key
+// can't be packed into fixed-width words, however the hash of the key is
+// computed once, when the key is built, and it's compared before the strings.
 typedef struct {
 	char *reg, *convo_id;
+	uint32_t hash;
 } la_ohma_key;
 
-static uint32_t la_ohma_key_hash(void const *key) {
-	la_ohma_key const *k = key;
+static uint32_t la_ohma_key_hash_compute(la_ohma_key const *k) {
 	uint32_t h = la_hash_string(k->reg, LA_HASH_INIT);
 	h = la_hash_string(k->convo_id, h);
 	return h;
 }
 
+static uint32_t la_ohma_key_hash(void const *key) {
+	la_ohma_key const *k = key;
+	return k->hash;
+}
+
 static bool la_ohma_key_compare(void const *key1, void const *key2) {
 	la_ohma_key const *k1 = key1;
 	la_ohma_key const *k2 = key2;
-	return (!strcmp(k1->reg, k2->reg) &&
+	return (k1->hash == k2->hash &&
+			!strcmp(k1->reg, k2->reg) &&
 			!strcmp(k1->convo_id, k2->convo_id));
 }
 
@@ -70,26 +80,75 @@ static void *la_ohma_key_get(void const *msg) {
 	LA_NEW(la_ohma_key, key);
 	key->reg = strdup(amsg->reg);
 	key->convo_id = strdup(amsg->convo_id);
+	key->hash = la_ohma_key_hash_compute(key);
 	la_debug_print(D_INFO, "ALLOC KEY %s %s\n", key->reg, key->convo_id);
 	return (void *)key;
 }
 
-static void *la_ohma_tmp_key_get(void const *msg) {
+static void la_ohma_tmp_key_fill(void *keyptr, void const *msg) {
+	la_assert(keyptr != NULL);
 	la_assert(msg != NULL);
 	la_ohma_msg const *amsg = msg;
-	LA_NEW(la_ohma_key, key);
+	la_ohma_key *key = keyptr;
 	key->reg = (char *)amsg->reg;
 	key->convo_id = (char *)amsg->convo_id;
-	return (void *)key;
+	key->hash = la_ohma_key_hash_compute(key);
+}
+
+// Serialized key format: registration, NUL, conversation ID
+static size_t la_ohma_key_serialize(void const *keyptr, uint8_t *buf, size_t len) {
+	la_assert(keyptr != NULL);
+	la_ohma_key const *key = keyptr;
+	size_t reg_len = strlen(key->reg);
+	size_t convo_id_len = strlen(key->convo_id);
+	size_t needed = reg_len + 1 + convo_id_len;
+	if(len >= needed) {
+		memcpy(buf, key->reg, reg_len + 1);
+		memcpy(buf + reg_len + 1, key->convo_id, convo_id_len);
+	}
+	return needed;
 }
 
-static la_reasm_table_funcs ohma_reasm_funcs = {
+static void *la_ohma_key_deserialize(uint8_t const *buf, size_t len) {
+	la_assert(buf != NULL);
+	uint8_t const *sep = memchr(buf, '\0', len);
+	if(sep == NULL) {
+		return NULL;
+	}
+	size_t reg_len = sep - buf;
+	size_t convo_id_len = len - reg_len - 1;
+	if(memchr(sep + 1, '\0', convo_id_len) != NULL) {
+		return NULL;
+	}
+	LA_NEW(la_ohma_key, key);
+	key->reg = LA_XCALLOC(reg_len + 1, sizeof(char));
+	memcpy(key->reg, buf, reg_len);
+	key->convo_id = LA_XCALLOC(convo_id_len + 1, sizeof(char));
+	memcpy(key->convo_id, sep + 1, convo_id_len);
+	key->hash = la_ohma_key_hash_compute(key);
+	return key;
+}
+
+static la_reasm_table_funcs_ex ohma_reasm_funcs = {
 	.get_key = la_ohma_key_get,
-	.get_tmp_key = la_ohma_tmp_key_get,
+	.fill_tmp_key = la_ohma_tmp_key_fill,
+	.tmp_key_size = sizeof(la_ohma_key),
 	.hash_key = la_ohma_key_hash,
 	.compare_keys = la_ohma_key_compare,
-	.destroy_key = la_ohma_key_destroy
+	.destroy_key = la_ohma_key_destroy,
+	.name = "ohma",
+	.serialize_key = la_ohma_key_serialize,
+	.deserialize_key = la_ohma_key_deserialize
 };
+
+la_reasm_table *la_ohma_reasm_table_get(la_reasm_ctx *rctx) {
+	la_reasm_table *rtable = la_reasm_table_lookup(rctx, &la_DEF_ohma_msg);
+	if(rtable == NULL) {
+		rtable = la_reasm_table_new_ex(rctx, &la_DEF_ohma_msg,
+				ohma_reasm_funcs, LA_OHMA_REASM_TABLE_CLEANUP_INTERVAL);
+	}
+	return rtable;
+}
 #endif  // WITH_JANSSON
 
 /********************************************************************************
@@ -226,9 +285,9 @@ restart:
 		json_decref(root);
 		goto json_fail;
 	}
-	msg->version = strdup(version);
+	msg->version = LA_XSTRDUP(version);
 	if(convo_id) {
-		msg->convo_id = strdup(convo_id);
+		msg->convo_id = LA_XSTRDUP(convo_id);
 	}
 	char *sym_key = NULL, *iv = NULL, *signature = NULL;
 	if(json_unpack_ex(root, &err, 0LU, "{s?:s, s?:s, s?:s}",
@@ -266,11 +325,7 @@ restart:
 
 		la_reasm_table *ohma_rtable = NULL;
 		if(rtables != NULL) {       // reassembly engine is enabled
-			ohma_rtable = la_reasm_table_lookup(rtables, &la_DEF_ohma_msg);
-			if(ohma_rtable == NULL) {
-				ohma_rtable = la_reasm_table_new(rtables, &la_DEF_ohma_msg,
-						ohma_reasm_funcs, LA_OHMA_REASM_TABLE_CLEANUP_INTERVAL);
-			}
+			ohma_rtable = la_ohma_reasm_table_get(rtables);
 			msg->reasm_status = la_reasm_fragment_add(ohma_rtable,
 					&(la_reasm_fragment_info){
 					.msg_info = msg,
@@ -298,7 +353,7 @@ restart:
 		msg->payload = la_octet_string_new(reassembled_message,
 				strlen((char *)reassembled_message));
 	} else {
-		msg->payload = la_octet_string_new(strdup(message), strlen(message));
+		msg->payload = la_octet_string_new(LA_XSTRDUP(message), strlen(message));
 	}
 
 	LA_XFREE(inflated.buf);
@@ -421,35 +476,35 @@ void la_ohma_format_json(la_vstring *vstr, void const *data) {
 	la_assert(data);
 
 	la_ohma_msg const *msg = data;
-	la_json_append_int64(vstr, "err", msg->err);
+	la_json_append_int64_k(vstr, LA_JSON_KEY("err"), msg->err);
 	if(msg->err == LA_OHMA_SUCCESS) {
 		if(msg->version) {
-			la_json_append_string(vstr, "version", msg->version);
+			la_json_append_string_k(vstr, LA_JSON_KEY("version"), msg->version);
 		}
 		if(msg->convo_id) {
-			la_json_append_string(vstr, "msg_id", msg->convo_id);
+			la_json_append_string_k(vstr, LA_JSON_KEY("msg_id"), msg->convo_id);
 		}
 		if(msg->msg_seq > 0) {
-			la_json_append_int64(vstr, "msg_seq", msg->msg_seq);
+			la_json_append_int64_k(vstr, LA_JSON_KEY("msg_seq"), msg->msg_seq);
 		}
 		if(msg->msg_total > 0) {
-			la_json_append_int64(vstr, "msg_total", msg->msg_total);
+			la_json_append_int64_k(vstr, LA_JSON_KEY("msg_total"), msg->msg_total);
 		}
-		la_json_append_string(vstr, "reasm_status", la_reasm_status_name_get(msg->reasm_status));
+		la_json_append_string_k(vstr, LA_JSON_KEY("reasm_status"), la_reasm_status_name_get(msg->reasm_status));
 		if(msg->sym_key != NULL) {
-			la_json_append_octet_string(vstr, "sym_key", msg->sym_key->buf, msg->sym_key->len);
+			la_json_append_octet_string_k(vstr, LA_JSON_KEY("sym_key"), msg->sym_key->buf, msg->sym_key->len);
 		}
 		if(msg->iv != NULL) {
-			la_json_append_octet_string(vstr, "iv", msg->iv->buf, msg->iv->len);
+			la_json_append_octet_string_k(vstr, LA_JSON_KEY("iv"), msg->iv->buf, msg->iv->len);
 		}
 		if(msg->signature != NULL) {
-			la_json_append_octet_string(vstr, "signature", msg->signature->buf, msg->signature->len);
+			la_json_append_octet_string_k(vstr, LA_JSON_KEY("signature"), msg->signature->buf, msg->signature->len);
 		}
 		if(msg->payload != NULL) {
 			if(is_printable(msg->payload->buf, msg->payload->len)) {
-				la_json_append_string(vstr, "text", (char *)msg->payload->buf);
+				la_json_append_string_k(vstr, LA_JSON_KEY("text"), (char *)msg->payload->buf);
 			} else {
-				la_json_append_octet_string(vstr, "octet_string",
+				la_json_append_octet_string_k(vstr, LA_JSON_KEY("octet_string"),
 						msg->payload->buf, msg->payload->len);
 			}
 		}
@@ -464,5 +519,6 @@ la_type_descriptor const la_DEF_ohma_msg = {
 	.format_text = la_ohma_format_text,
 	.format_json = la_ohma_format_json,
 	.json_key = "ohma",
+	.json_key_k = LA_JSON_KEY("ohma"),
 	.destroy = &la_ohma_msg_destroy
 };
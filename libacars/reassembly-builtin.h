@@ -0,0 +1,27 @@
+/*
+ *  This file is a part of libacars
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+
+#ifndef LA_REASSEMBLY_BUILTIN_H
+#define LA_REASSEMBLY_BUILTIN_H 1
+
+#include "config.h"                         // WITH_JANSSON
+#include <libacars/reassembly.h>            // la_reasm_ctx, la_reasm_table
+
+// Functions returning reassembly tables of libacars decoders, creating them
+// if necessary. Used when restoring reassembly context snapshots.
+
+// acars.c
+la_reasm_table *la_acars_reasm_table_get(la_reasm_ctx *rctx);
+
+// miam.c
+la_reasm_table *la_miam_file_reasm_table_get(la_reasm_ctx *rctx);
+
+#ifdef WITH_JANSSON
+// ohma.c
+la_reasm_table *la_ohma_reasm_table_get(la_reasm_ctx *rctx);
+#endif
+
+#endif // !LA_REASSEMBLY_BUILTIN_H
@@ -8,38 +8,116 @@
 #ifdef HAVE_SYS_TIME_H
 #include <sys/time.h>                   // struct timeval
 #endif
-#include <string.h>                     // strdup
+#include <stdint.h>                     // int64_t, uint64_t
+#include <stdlib.h>                     // qsort
+#include <string.h>                     // strdup, memcpy
 #include <libacars/macros.h>            // la_assert
 #include <libacars/hash.h>              // la_hash
 #include <libacars/list.h>              // la_list
-#include <libacars/util.h>              // LA_XCALLOC, LA_XFREE, la_octet_string
+#include <libacars/util.h>              // LA_XCALLOC, LA_XREALLOC, LA_XFREE
+#include <libacars/arena.h>             // la_arena_activate
+#include <libacars/lock.h>              // la_lock
+#include <libacars/reassembly-builtin.h> // la_acars_reasm_table_get(), etc.
 #include <libacars/reassembly.h>
 
+typedef struct la_reasm_table_entry_s la_reasm_table_entry;
+
+// Hierarchical timing wheel used to expire stale reassembly table entries.
+// Level 0 has one-second slots, each subsequent level has slots
+// LA_REASM_WHEEL_SLOTS times wider than the previous one. Entries are placed
+// in slots according to their expiry deadlines. When the wheel time crosses
+// the boundary of a higher level slot, entries from that slot are moved
+// (cascaded) down to lower levels. Entries landing in a level 0 slot are
+// expired when the wheel time reaches that slot. This way the cost of each
+// cleanup is proportional to the number of entries which are actually due,
+// rather than to the total number of entries in the table.
+#define LA_REASM_WHEEL_BITS 6
+#define LA_REASM_WHEEL_SLOTS (1 << LA_REASM_WHEEL_BITS)
+#define LA_REASM_WHEEL_MASK (LA_REASM_WHEEL_SLOTS - 1)
+#define LA_REASM_WHEEL_LEVELS 4
+
+typedef struct {
+	la_reasm_table_entry *slots[LA_REASM_WHEEL_LEVELS][LA_REASM_WHEEL_SLOTS];
+	uint64_t occupied[LA_REASM_WHEEL_LEVELS];   /* bitmaps of non-empty slots */
+	int64_t time;                       /* the last second processed, in rx_time units */
+	size_t entry_cnt;                   /* number of entries in the wheel */
+	bool started;                       /* false until the first entry is added */
+} la_reasm_wheel;
+
+// A part of a reassembly table. Tables in sharded reassembly contexts are
+// split into multiple shards, each one protected by its own lock. Fragments
+// are routed to shards by the hash of their reassembly key, so all fragments
+// of a particular message always land in the same shard.
+typedef struct {
+	la_hash *fragment_table;            /* keyed with packet identifiers, values are
+	                                       la_reasm_table_entries */
+	int frag_cnt;                       /* counts added fragments (up to cleanup_interval) */
+	la_reasm_wheel wheel;               /* expiry deadlines of fragment_table entries */
+	la_reasm_table_entry *lru_head;     /* least recently used entry */
+	la_reasm_table_entry *lru_tail;     /* most recently used entry */
+	size_t entry_cnt;                   /* number of entries in fragment_table */
+	size_t byte_cnt;                    /* memory used by entries in fragment_table */
+	uint64_t evicted_cnt;               /* number of entries evicted due to limits */
+	uint64_t expired_cnt;               /* number of entries expired due to timeout */
+	uint64_t status_cnt[LA_REASM_STATUS_MAX + 1];
+	                                    /* la_reasm_fragment_add() results by status */
+	uint64_t completed_frags_cnt;       /* number of fragments of completed messages */
+	la_reasm_table *rtable;             /* the table this shard belongs to */
+	la_lock lock;                       /* protects this shard (sharded contexts only) */
+} la_reasm_shard;
+
 typedef struct la_reasm_table_s {
 	void const *key;                    /* a pointer identifying the protocol
 	                                       owning this reasm_table (la_type_descriptor
 	                                       can be used for this purpose). Due to small
 	                                       number of protocols, hash would be an overkill
 	                                       here. */
-	la_hash *fragment_table;            /* keyed with packet identifiers, values are
-	                                       la_reasm_table_entries */
-	la_reasm_table_funcs funcs;         /* protocol-specific callbacks */
+	la_reasm_table_funcs_ex funcs;      /* protocol-specific callbacks */
+	la_reasm_get_key_func *get_tmp_key; /* legacy temporary key constructor
+	                                       (tables created with la_reasm_table_new()) */
 	int cleanup_interval;               /* expire old entries every cleanup_interval
-	                                       number of processed fragments */
-	int frag_cnt;                       /* counts added fragments (up to cleanup_interval) */
+	                                       number of fragments processed by a shard */
+	int shard_cnt;                      /* number of shards */
+	bool locking;                       /* whether shards need to be locked */
+	la_reasm_shard *shards;             /* array of shard_cnt shards */
+	size_t max_entries;                 /* entry limit (0 = unlimited) */
+	size_t max_bytes;                   /* memory limit (0 = unlimited) */
+	la_reasm_ctx *rctx;                 /* the context this table belongs to */
+	int64_t volatile byte_cnt;          /* memory used by entries in all shards */
+	int64_t volatile peak_byte_cnt;     /* highest value of byte_cnt */
 } la_reasm_table;
 
 struct la_reasm_ctx_s {
 	la_list *rtables;                   /* list of reasm_tables, one per protocol */
+	la_config_snapshot const *config;   /* configuration for decoders using this context
+	                                       (NULL = use thread or global config) */
+	int shard_cnt;                      /* number of shards in each reasm_table */
+	bool locking;                       /* true for contexts created with
+	                                       la_reasm_ctx_new_sharded() */
+	la_lock lock;                       /* protects rtables list (sharded contexts only) */
+	size_t max_entries;                 /* entry limit for all tables (0 = unlimited) */
+	size_t max_bytes;                   /* memory limit for all tables (0 = unlimited) */
+	int64_t volatile entry_cnt;         /* number of entries in all tables */
+	int64_t volatile byte_cnt;          /* memory used by entries in all tables */
 };
 
-typedef struct la_reasm_fragment_s {
+// Sequence numbers of fragments received out of order which are lower than
+// this value are tracked in a bitmap, which makes duplicate detection
+// a constant time operation. Higher sequence numbers are searched for in the
+// fragment index.
+#define LA_REASM_SEQ_BITMAP_MAX 4096
+
+#define SEQ_UNINITIALIZED -2
+
+// Location of a fragment payload in the buffer of its table entry
+typedef struct {
 	int seq_num;                        /* sequence number of this fragment */
-	la_octet_string payload;            /* payload of this fragment */
+	int offset;                         /* offset of the payload in the entry buffer */
+	int len;                            /* payload length */
 } la_reasm_fragment;
 
-// the header of the fragment list
-typedef struct {
+// Reassembly state of a single message
+struct la_reasm_table_entry_s {
 	int prev_seq_num;                   /* sequence number of previous fragment */
 
 	int frags_collected_total_len;      /* sum of msg_data_len for all fragments received */
@@ -56,52 +134,335 @@ typedef struct {
 
 	struct timeval reasm_timeout;       /* reassembly timeout to be applied to this message */
 
-	la_list *fragment_list;             /* fragments gathered so far (list of la_reasm_fragments) */
-} la_reasm_table_entry;
+	uint8_t *buf;                       /* payloads of fragments gathered so far,
+	                                       in order of arrival */
+
+	size_t buf_size;                    /* allocated size of buf */
+
+	la_reasm_fragment *index;           /* fragments gathered so far sorted by seq_num
+	                                       (only when out of order delivery is allowed) */
+
+	int index_len;                      /* number of elements in index */
+
+	int index_size;                     /* allocated length of index */
+
+	uint64_t *seq_bitmap;               /* seq_nums of fragments gathered so far
+	                                       (only when out of order delivery is allowed,
+	                                       for seq_nums below LA_REASM_SEQ_BITMAP_MAX) */
+
+	int seq_bitmap_len;                 /* length of seq_bitmap in 64-bit words */
+
+	int final_seq_num;                  /* seq_num of the fragment marked as final
+	                                       (only when out of order delivery is allowed) */
+
+	bool out_of_order;                  /* the entry has been created by a fragment with
+	                                       LA_ALLOW_OUT_OF_ORDER_DELIVERY flag set */
+
+	void *key;                          /* the key of this entry in fragment_table */
+
+	int64_t deadline;                   /* the first second at which this entry is
+	                                       known to be expired */
+
+	la_reasm_wheel *wheel;              /* the timing wheel holding this entry
+	                                       (NULL if not linked into any) */
+
+	la_reasm_table_entry *wheel_next;   /* next entry in the same wheel slot */
+
+	la_reasm_table_entry **wheel_pprev; /* the pointer pointing to this entry */
+
+	uint8_t wheel_level;                /* the wheel slot holding this entry */
+	uint8_t wheel_slot;
+
+	la_reasm_shard *shard;              /* the shard holding this entry */
+
+	size_t byte_cnt;                    /* memory used by this entry (approximate) */
+
+	la_reasm_table_entry *lru_prev;     /* LRU list of the shard */
+	la_reasm_table_entry *lru_next;
+};
+
+// Reassembly state outlives a single decode, so it must never be allocated
+// from the arena which might be active in the calling thread. Functions which
+// allocate long-lived objects suspend the arena for the duration of the call.
 
 la_reasm_ctx *la_reasm_ctx_new() {
+	la_arena *saved_arena = la_arena_activate(NULL);
 	LA_NEW(la_reasm_ctx, rctx);
+	rctx->shard_cnt = 1;
+	la_arena_activate(saved_arena);
+	return rctx;
+}
+
+#define LA_REASM_MAX_SHARDS 1024
+
+// Creates a reassembly context which may be used by multiple threads
+// concurrently. Each reassembly table is split into shard_cnt shards with
+// separate locks, so that threads processing fragments of different messages
+// rarely contend with each other.
+la_reasm_ctx *la_reasm_ctx_new_sharded(int shard_cnt) {
+	if(shard_cnt < 1) {
+		shard_cnt = 1;
+	} else if(shard_cnt > LA_REASM_MAX_SHARDS) {
+		shard_cnt = LA_REASM_MAX_SHARDS;
+	}
+	la_reasm_ctx *rctx = la_reasm_ctx_new();
+	rctx->shard_cnt = shard_cnt;
+	rctx->locking = true;
+	la_lock_init(&rctx->lock);
 	return rctx;
 }
 
-static la_reasm_fragment *la_reasm_fragment_new(int seq_num, uint8_t *payload, size_t len) {
-	LA_NEW(la_reasm_fragment, fragment);
-	fragment->seq_num = seq_num;
+// Inserts the entry into the wheel slot matching its deadline. Entries which
+// are already due are placed in the slot of the second given by min_time.
+static void la_reasm_wheel_link(la_reasm_wheel *wheel, la_reasm_table_entry *rt_entry,
+		int64_t min_time) {
+	int64_t when = rt_entry->deadline > min_time ? rt_entry->deadline : min_time;
+	int64_t delta = when - wheel->time;
+	int level = 0;
+	while(level < LA_REASM_WHEEL_LEVELS - 1 &&
+			delta >= (int64_t)1 << (LA_REASM_WHEEL_BITS * (level + 1))) {
+		level++;
+	}
+	// Deadlines too far in the future to fit in the wheel are parked in the
+	// furthest slot of the top level and re-examined when it is cascaded.
+	int64_t horizon = (int64_t)1 << (LA_REASM_WHEEL_BITS * LA_REASM_WHEEL_LEVELS);
+	if(delta >= horizon) {
+		when = wheel->time + horizon - 1;
+	}
+	int slot = (when >> (LA_REASM_WHEEL_BITS * level)) & LA_REASM_WHEEL_MASK;
+
+	la_reasm_table_entry **head = &wheel->slots[level][slot];
+	rt_entry->wheel_next = *head;
+	if(*head != NULL) {
+		(*head)->wheel_pprev = &rt_entry->wheel_next;
+	}
+	*head = rt_entry;
+	rt_entry->wheel_pprev = head;
+	rt_entry->wheel = wheel;
+	rt_entry->wheel_level = level;
+	rt_entry->wheel_slot = slot;
+	wheel->occupied[level] |= (uint64_t)1 << slot;
+	wheel->entry_cnt++;
+}
+
+static void la_reasm_wheel_unlink(la_reasm_table_entry *rt_entry) {
+	la_reasm_wheel *wheel = rt_entry->wheel;
+	if(wheel == NULL) {
+		return;
+	}
+	*rt_entry->wheel_pprev = rt_entry->wheel_next;
+	if(rt_entry->wheel_next != NULL) {
+		rt_entry->wheel_next->wheel_pprev = rt_entry->wheel_pprev;
+	}
+	if(wheel->slots[rt_entry->wheel_level][rt_entry->wheel_slot] == NULL) {
+		wheel->occupied[rt_entry->wheel_level] &= ~((uint64_t)1 << rt_entry->wheel_slot);
+	}
+	wheel->entry_cnt--;
+	rt_entry->wheel = NULL;
+	rt_entry->wheel_next = NULL;
+	rt_entry->wheel_pprev = NULL;
+}
+
+// Detaches and returns the whole list of entries from the given wheel slot
+static la_reasm_table_entry *la_reasm_wheel_slot_take(la_reasm_wheel *wheel, int level, int slot) {
+	la_reasm_table_entry *list = wheel->slots[level][slot];
+	wheel->slots[level][slot] = NULL;
+	wheel->occupied[level] &= ~((uint64_t)1 << slot);
+	for(la_reasm_table_entry *e = list; e != NULL; e = e->wheel_next) {
+		e->wheel = NULL;
+		e->wheel_pprev = NULL;
+		wheel->entry_cnt--;
+	}
+	return list;
+}
+
+// Updates usage counter of the context. Counters of sharded contexts
+// are shared between threads, hence they are updated atomically.
+static int64_t la_reasm_usage_add(la_reasm_ctx *rctx, int64_t volatile *counter, int64_t val) {
+	if(rctx->locking) {
+		return la_atomic_add(counter, val);
+	}
+	return *counter += val;
+}
+
+static int64_t la_reasm_usage_get(la_reasm_ctx *rctx, int64_t volatile *counter) {
+	if(rctx->locking) {
+		return la_atomic_load(counter);
+	}
+	return *counter;
+}
+
+static void la_reasm_usage_max(la_reasm_ctx *rctx, int64_t volatile *counter, int64_t val) {
+	if(rctx->locking) {
+		la_atomic_max(counter, val);
+	} else if(*counter < val) {
+		*counter = val;
+	}
+}
+
+// Accounts the given amount of memory to the entry, its shard and its context
+static void la_reasm_entry_charge(la_reasm_table_entry *rt_entry, int64_t bytes) {
+	la_reasm_shard *shard = rt_entry->shard;
+	rt_entry->byte_cnt += bytes;
+	shard->byte_cnt += bytes;
+	la_reasm_table *rtable = shard->rtable;
+	la_reasm_usage_add(rtable->rctx, &rtable->rctx->byte_cnt, bytes);
+	int64_t table_byte_cnt = la_reasm_usage_add(rtable->rctx, &rtable->byte_cnt, bytes);
+	if(bytes > 0) {
+		la_reasm_usage_max(rtable->rctx, &rtable->peak_byte_cnt, table_byte_cnt);
+	}
+}
+
+// Appends the entry at the tail (most recently used end) of its shard's LRU list
+static void la_reasm_lru_link(la_reasm_table_entry *rt_entry) {
+	la_reasm_shard *shard = rt_entry->shard;
+	rt_entry->lru_next = NULL;
+	rt_entry->lru_prev = shard->lru_tail;
+	if(shard->lru_tail != NULL) {
+		shard->lru_tail->lru_next = rt_entry;
+	} else {
+		shard->lru_head = rt_entry;
+	}
+	shard->lru_tail = rt_entry;
+}
+
+static void la_reasm_lru_unlink(la_reasm_table_entry *rt_entry) {
+	la_reasm_shard *shard = rt_entry->shard;
+	if(rt_entry->lru_prev != NULL) {
+		rt_entry->lru_prev->lru_next = rt_entry->lru_next;
+	} else {
+		shard->lru_head = rt_entry->lru_next;
+	}
+	if(rt_entry->lru_next != NULL) {
+		rt_entry->lru_next->lru_prev = rt_entry->lru_prev;
+	} else {
+		shard->lru_tail = rt_entry->lru_prev;
+	}
+	rt_entry->lru_prev = rt_entry->lru_next = NULL;
+}
+
+// Marks the entry as most recently used
+static void la_reasm_lru_touch(la_reasm_table_entry *rt_entry) {
+	if(rt_entry->shard->lru_tail != rt_entry) {
+		la_reasm_lru_unlink(rt_entry);
+		la_reasm_lru_link(rt_entry);
+	}
+}
 
-	if(payload != NULL && len > 0) {
-		uint8_t *buf = LA_XCALLOC(len, sizeof(uint8_t));
-		memcpy(buf, payload, len);
-		fragment->payload.buf = buf;
-		fragment->payload.len = len;
+// Appends the fragment payload to the entry buffer. The buffer always has
+// a spare byte at the end, so that the reassembled message can be
+// NUL-terminated without reallocation.
+static void la_reasm_entry_append(la_reasm_table_entry *rt_entry, uint8_t const *data, int len) {
+	size_t needed = (size_t)rt_entry->frags_collected_total_len + len + 1;
+	if(needed > rt_entry->buf_size) {
+		size_t new_size = rt_entry->buf_size > 0 ? rt_entry->buf_size * 2 : 256;
+		if(new_size < needed) {
+			new_size = needed;
+		}
+		rt_entry->buf = LA_XREALLOC(rt_entry->buf, new_size);
+		la_reasm_entry_charge(rt_entry, new_size - rt_entry->buf_size);
+		rt_entry->buf_size = new_size;
+	}
+	if(data != NULL) {
+		memcpy(rt_entry->buf + rt_entry->frags_collected_total_len, data, len);
+	} else {
+		memset(rt_entry->buf + rt_entry->frags_collected_total_len, 0, len);
 	}
-	return fragment;
 }
 
-static void la_reasm_fragment_destroy(void *data) {
-	if(data == NULL) {
+// Returns the position of the first fragment in the index with seq_num
+// not less than the given one
+static int la_reasm_entry_index_search(la_reasm_table_entry const *rt_entry, int seq_num) {
+	int lo = 0, hi = rt_entry->index_len;
+	while(lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if(rt_entry->index[mid].seq_num < seq_num) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+static void la_reasm_seq_bitmap_set(la_reasm_table_entry *rt_entry, int seq_num) {
+	if(seq_num < 0 || seq_num >= LA_REASM_SEQ_BITMAP_MAX) {
 		return;
 	}
-	la_reasm_fragment *fragment = data;
-	LA_XFREE(fragment->payload.buf);
-	LA_XFREE(fragment);
+	int word = seq_num / 64;
+	if(word >= rt_entry->seq_bitmap_len) {
+		int new_len = rt_entry->seq_bitmap_len > 0 ? rt_entry->seq_bitmap_len * 2 : 1;
+		while(new_len <= word) {
+			new_len *= 2;
+		}
+		rt_entry->seq_bitmap = LA_XREALLOC(rt_entry->seq_bitmap, new_len * sizeof(uint64_t));
+		memset(rt_entry->seq_bitmap + rt_entry->seq_bitmap_len, 0,
+				(new_len - rt_entry->seq_bitmap_len) * sizeof(uint64_t));
+		la_reasm_entry_charge(rt_entry, (new_len - rt_entry->seq_bitmap_len) * sizeof(uint64_t));
+		rt_entry->seq_bitmap_len = new_len;
+	}
+	rt_entry->seq_bitmap[word] |= (uint64_t)1 << (seq_num % 64);
 }
 
-static int la_reasm_compare_fragment_seq_numbers(void const *data1, void const *data2) {
-	la_assert(data1);
-	la_assert(data2);
-	la_reasm_fragment const *f1 = data1;
-	la_reasm_fragment const *f2 = data2;
-	return f1->seq_num - f2->seq_num;
+// Records the location of the fragment which has just been appended to the
+// buffer in the index, keeping it sorted by seq_num. Fragments usually arrive
+// in order, so the common case of appending at the end is checked first.
+static void la_reasm_entry_index_add(la_reasm_table_entry *rt_entry, int seq_num, int len) {
+	if(rt_entry->index_len == rt_entry->index_size) {
+		int new_size = rt_entry->index_size > 0 ? rt_entry->index_size * 2 : 8;
+		rt_entry->index = LA_XREALLOC(rt_entry->index, new_size * sizeof(la_reasm_fragment));
+		la_reasm_entry_charge(rt_entry, (new_size - rt_entry->index_size) * sizeof(la_reasm_fragment));
+		rt_entry->index_size = new_size;
+	}
+	int pos = rt_entry->index_len;
+	if(pos > 0 && rt_entry->index[pos - 1].seq_num > seq_num) {
+		pos = la_reasm_entry_index_search(rt_entry, seq_num);
+		memmove(rt_entry->index + pos + 1, rt_entry->index + pos,
+				(rt_entry->index_len - pos) * sizeof(la_reasm_fragment));
+	}
+	rt_entry->index[pos] = (la_reasm_fragment){
+		.seq_num = seq_num,
+		.offset = rt_entry->frags_collected_total_len,
+		.len = len
+	};
+	rt_entry->index_len++;
+	la_reasm_seq_bitmap_set(rt_entry, seq_num);
+}
+
+static bool la_reasm_fragment_seq_num_already_exists(la_reasm_table_entry const *rt_entry, int seq_num) {
+	if(seq_num >= 0 && seq_num < LA_REASM_SEQ_BITMAP_MAX) {
+		int word = seq_num / 64;
+		return word < rt_entry->seq_bitmap_len &&
+			(rt_entry->seq_bitmap[word] >> (seq_num % 64)) & 1;
+	}
+	int pos = la_reasm_entry_index_search(rt_entry, seq_num);
+	return pos < rt_entry->index_len && rt_entry->index[pos].seq_num == seq_num;
+}
+
+// Returns true if seq_nums of fragments received out of order form
+// a contiguous sequence starting at seq_num_first (if known) and ending
+// with the final fragment (if it has been received). The index is sorted
+// and has no duplicates, so this takes constant time.
+static bool la_reasm_fragment_sequence_is_complete(la_reasm_table_entry const *rt_entry,
+		int seq_num_first) {
+	if(rt_entry->index_len == 0) {
+		return false;
+	}
+	int first = rt_entry->index[0].seq_num;
+	int last = rt_entry->index[rt_entry->index_len - 1].seq_num;
+	return (seq_num_first == SEQ_FIRST_NONE || first == seq_num_first) &&
+		(rt_entry->final_seq_num == SEQ_UNINITIALIZED || last == rt_entry->final_seq_num) &&
+		last - first + 1 == rt_entry->index_len;
 }
 
-static bool la_reasm_fragment_seq_num_already_exists(la_list *fragment_list, int seq_num) {
-	for(la_list *l = fragment_list; l != NULL; l = la_list_next(l)) {
-		la_reasm_fragment *fragment = l->data;
-		if(fragment->seq_num == seq_num) {
-			return true;
+// Returns true if fragment payloads are stored in the buffer in sequence order
+static bool la_reasm_fragments_are_contiguous(la_reasm_fragment const *index, int index_len) {
+	for(int i = 1; i < index_len; i++) {
+		if(index[i].offset != index[i-1].offset + index[i-1].len) {
+			return false;
 		}
 	}
-	return false;
+	return true;
 }
 
 static void la_reasm_table_entry_destroy(void *rt_ptr) {
@@ -109,7 +470,14 @@ static void la_reasm_table_entry_destroy(void *rt_ptr) {
 		return;
 	}
 	la_reasm_table_entry *rt_entry = rt_ptr;
-	la_list_free_full(rt_entry->fragment_list, la_reasm_fragment_destroy);
+	la_reasm_wheel_unlink(rt_entry);
+	la_reasm_lru_unlink(rt_entry);
+	la_reasm_entry_charge(rt_entry, -(int64_t)rt_entry->byte_cnt);
+	la_reasm_usage_add(rt_entry->shard->rtable->rctx, &rt_entry->shard->rtable->rctx->entry_cnt, -1);
+	rt_entry->shard->entry_cnt--;
+	LA_XFREE(rt_entry->buf);
+	LA_XFREE(rt_entry->index);
+	LA_XFREE(rt_entry->seq_bitmap);
 	LA_XFREE(rt_entry);
 }
 
@@ -118,7 +486,13 @@ static void la_reasm_table_destroy(void *table) {
 		return;
 	}
 	la_reasm_table *rtable = table;
-	la_hash_destroy(rtable->fragment_table);
+	for(int i = 0; i < rtable->shard_cnt; i++) {
+		la_hash_destroy(rtable->shards[i].fragment_table);
+		if(rtable->locking) {
+			la_lock_destroy(&rtable->shards[i].lock);
+		}
+	}
+	LA_XFREE(rtable->shards);
 	LA_XFREE(rtable);
 }
 
@@ -128,13 +502,51 @@ void la_reasm_ctx_destroy(void *ctx) {
 	}
 	la_reasm_ctx *rctx = ctx;
 	la_list_free_full(rctx->rtables, la_reasm_table_destroy);
+	if(rctx->locking) {
+		la_lock_destroy(&rctx->lock);
+	}
 	LA_XFREE(rctx);
 }
 
-la_reasm_table *la_reasm_table_lookup(la_reasm_ctx *rctx, void const *table_id) {
+// Binds the given configuration snapshot to the reassembly context. It then
+// applies to all messages decoded with this context, regardless of the
+// calling thread. The snapshot must outlive the context (or the binding).
+// NULL restores the default behavior.
+void la_reasm_ctx_config_set(la_reasm_ctx *rctx, la_config_snapshot const *snap) {
 	la_assert(rctx != NULL);
-	la_assert(table_id != NULL);
+	rctx->config = snap;
+}
 
+la_config_snapshot const *la_reasm_ctx_config_get(la_reasm_ctx const *rctx) {
+	la_assert(rctx != NULL);
+	return rctx->config;
+}
+
+// Sets the maximum number of entries and the maximum amount of memory
+// which may be used by all reassembly tables of the context together.
+// Zero means no limit.
+void la_reasm_ctx_limits_set(la_reasm_ctx *rctx, size_t max_entries, size_t max_bytes) {
+	la_assert(rctx != NULL);
+	rctx->max_entries = max_entries;
+	rctx->max_bytes = max_bytes;
+}
+
+uint64_t la_reasm_ctx_eviction_cnt_get(la_reasm_ctx *rctx) {
+	la_assert(rctx != NULL);
+	uint64_t cnt = 0;
+	if(rctx->locking) {
+		la_lock_acquire(&rctx->lock);
+	}
+	for(la_list *l = rctx->rtables; l != NULL; l = la_list_next(l)) {
+		cnt += la_reasm_table_eviction_cnt_get(l->data);
+	}
+	if(rctx->locking) {
+		la_lock_release(&rctx->lock);
+	}
+	return cnt;
+}
+
+static la_reasm_table *la_reasm_table_lookup_unlocked(la_reasm_ctx *rctx, void const *table_id) {
 	for(la_list *l = rctx->rtables; l != NULL; l = la_list_next(l)) {
 		la_reasm_table *rt = l->data;
 		if(rt->key == table_id) {
@@ -144,36 +556,206 @@ la_reasm_table *la_reasm_table_lookup(la_reasm_ctx *rctx, void const *table_id)
 	return NULL;
 }
 
-#define LA_REASM_DEFAULT_CLEANUP_INTERVAL 100
-
-la_reasm_table *la_reasm_table_new(la_reasm_ctx *rctx, void const *table_id,
-		la_reasm_table_funcs funcs, int cleanup_interval) {
+la_reasm_table *la_reasm_table_lookup(la_reasm_ctx *rctx, void const *table_id) {
 	la_assert(rctx != NULL);
 	la_assert(table_id != NULL);
-	la_assert(funcs.get_key);
-	la_assert(funcs.get_tmp_key);
-	la_assert(funcs.hash_key);
-	la_assert(funcs.compare_keys);
-	la_assert(funcs.destroy_key);
 
-	la_reasm_table *rtable = la_reasm_table_lookup(rctx, table_id);
+	if(rctx->locking) {
+		la_lock_acquire(&rctx->lock);
+	}
+	la_reasm_table *rtable = la_reasm_table_lookup_unlocked(rctx, table_id);
+	if(rctx->locking) {
+		la_lock_release(&rctx->lock);
+	}
+	return rtable;
+}
+
+#define LA_REASM_DEFAULT_CLEANUP_INTERVAL 100
+
+static la_reasm_table *la_reasm_table_create(la_reasm_ctx *rctx, void const *table_id,
+		la_reasm_table_funcs_ex funcs, la_reasm_get_key_func *get_tmp_key, int cleanup_interval) {
+	la_arena *saved_arena = la_arena_activate(NULL);
+	if(rctx->locking) {
+		la_lock_acquire(&rctx->lock);
+	}
+	la_reasm_table *rtable = la_reasm_table_lookup_unlocked(rctx, table_id);
 	if(rtable != NULL) {
 		goto end;
 	}
 	rtable = LA_XCALLOC(1, sizeof(la_reasm_table));
 	rtable->key = table_id;
-	rtable->fragment_table = la_hash_new(funcs.hash_key, funcs.compare_keys,
-			funcs.destroy_key, la_reasm_table_entry_destroy);
 	rtable->funcs = funcs;
+	rtable->get_tmp_key = get_tmp_key;
+	rtable->shard_cnt = rctx->shard_cnt;
+	rtable->locking = rctx->locking;
+	rtable->shards = LA_XCALLOC(rtable->shard_cnt, sizeof(la_reasm_shard));
+	rtable->rctx = rctx;
+	for(int i = 0; i < rtable->shard_cnt; i++) {
+		rtable->shards[i].rtable = rtable;
+		rtable->shards[i].fragment_table = la_hash_new(funcs.hash_key, funcs.compare_keys,
+				funcs.destroy_key, la_reasm_table_entry_destroy);
+		if(rtable->locking) {
+			la_lock_init(&rtable->shards[i].lock);
+		}
+	}
 
 	// Replace insane values with reasonable default
 	rtable->cleanup_interval = cleanup_interval > 0 ?
 		cleanup_interval : LA_REASM_DEFAULT_CLEANUP_INTERVAL;
 	rctx->rtables = la_list_append(rctx->rtables, rtable);
 end:
+	if(rctx->locking) {
+		la_lock_release(&rctx->lock);
+	}
+	la_arena_activate(saved_arena);
 	return rtable;
 }
 
+la_reasm_table *la_reasm_table_new(la_reasm_ctx *rctx, void const *table_id,
+		la_reasm_table_funcs funcs, int cleanup_interval) {
+	la_assert(rctx != NULL);
+	la_assert(table_id != NULL);
+	la_assert(funcs.get_key);
+	la_assert(funcs.get_tmp_key);
+	la_assert(funcs.hash_key);
+	la_assert(funcs.compare_keys);
+	la_assert(funcs.destroy_key);
+
+	la_reasm_table_funcs_ex funcs_ex = {
+		.get_key = funcs.get_key,
+		.hash_key = funcs.hash_key,
+		.compare_keys = funcs.compare_keys,
+		.destroy_key = funcs.destroy_key
+	};
+	return la_reasm_table_create(rctx, table_id, funcs_ex, funcs.get_tmp_key, cleanup_interval);
+}
+
+// Creates a reassembly table which builds temporary lookup keys in storage
+// provided by the reassembly engine, rather than allocating them on the heap.
+la_reasm_table *la_reasm_table_new_ex(la_reasm_ctx *rctx, void const *table_id,
+		la_reasm_table_funcs_ex funcs, int cleanup_interval) {
+	la_assert(rctx != NULL);
+	la_assert(table_id != NULL);
+	la_assert(funcs.get_key);
+	la_assert(funcs.fill_tmp_key);
+	la_assert(funcs.tmp_key_size > 0 && funcs.tmp_key_size <= LA_REASM_TMP_KEY_SIZE_MAX);
+	la_assert(funcs.hash_key);
+	la_assert(funcs.compare_keys);
+	la_assert(funcs.destroy_key);
+
+	return la_reasm_table_create(rctx, table_id, funcs, NULL, cleanup_interval);
+}
+
+// Storage for temporary lookup keys, suitably aligned for any key structure
+typedef union {
+	uint8_t buf[LA_REASM_TMP_KEY_SIZE_MAX];
+	void *ptr;
+	uint64_t u64;
+	double d;
+} la_reasm_tmp_key_storage;
+
+// Returns a temporary key for looking up the given message in the table.
+// It is either built in the given storage or allocated by the legacy callback.
+static void *la_reasm_tmp_key_get(la_reasm_table const *rtable, void const *msg_info,
+		la_reasm_tmp_key_storage *storage) {
+	void *key = NULL;
+	if(rtable->get_tmp_key != NULL) {
+		key = rtable->get_tmp_key(msg_info);
+	} else {
+		rtable->funcs.fill_tmp_key(storage, msg_info);
+		key = storage;
+	}
+	la_assert(key != NULL);
+	return key;
+}
+
+static void la_reasm_tmp_key_release(la_reasm_table const *rtable, void *key) {
+	if(rtable->get_tmp_key != NULL) {
+		LA_XFREE(key);
+	}
+}
+
+// Sets the maximum number of entries and the maximum amount of memory
+// which may be used by the reassembly table. In sharded contexts each
+// shard gets an equal part of the limit. Zero means no limit.
+void la_reasm_table_limits_set(la_reasm_table *rtable, size_t max_entries, size_t max_bytes) {
+	la_assert(rtable != NULL);
+	rtable->max_entries = max_entries;
+	rtable->max_bytes = max_bytes;
+}
+
+uint64_t la_reasm_table_eviction_cnt_get(la_reasm_table *rtable) {
+	la_assert(rtable != NULL);
+	uint64_t cnt = 0;
+	for(int i = 0; i < rtable->shard_cnt; i++) {
+		la_reasm_shard *shard = rtable->shards + i;
+		if(rtable->locking) {
+			la_lock_acquire(&shard->lock);
+		}
+		cnt += shard->evicted_cnt;
+		if(rtable->locking) {
+			la_lock_release(&shard->lock);
+		}
+	}
+	return cnt;
+}
+
+// Stores statistics of the given reassembly table in *stats
+void la_reasm_table_stats_get(la_reasm_table *rtable, la_reasm_table_stats *stats) {
+	la_assert(rtable != NULL);
+	la_assert(stats != NULL);
+	memset(stats, 0, sizeof(la_reasm_table_stats));
+	stats->table_id = rtable->key;
+	stats->name = rtable->funcs.name;
+	for(int i = 0; i < rtable->shard_cnt; i++) {
+		la_reasm_shard *shard = rtable->shards + i;
+		if(rtable->locking) {
+			la_lock_acquire(&shard->lock);
+		}
+		for(int s = 0; s <= LA_REASM_STATUS_MAX; s++) {
+			stats->status_cnt[s] += shard->status_cnt[s];
+			stats->frags_added += shard->status_cnt[s];
+		}
+		stats->expired_cnt += shard->expired_cnt;
+		stats->evicted_cnt += shard->evicted_cnt;
+		stats->completed_frags_cnt += shard->completed_frags_cnt;
+		stats->entry_cnt += shard->entry_cnt;
+		stats->byte_cnt += shard->byte_cnt;
+		if(rtable->locking) {
+			la_lock_release(&shard->lock);
+		}
+	}
+	stats->peak_byte_cnt = la_reasm_usage_get(rtable->rctx, &rtable->peak_byte_cnt);
+	// Shards are read one by one, so the peak might lag behind the current value
+	if(stats->peak_byte_cnt < stats->byte_cnt) {
+		stats->peak_byte_cnt = stats->byte_cnt;
+	}
+	if(stats->status_cnt[LA_REASM_COMPLETE] > 0) {
+		stats->avg_frags_per_msg = (double)stats->completed_frags_cnt /
+			stats->status_cnt[LA_REASM_COMPLETE];
+	}
+}
+
+// Stores statistics of up to max_cnt reassembly tables of the context in
+// the stats array. Returns the number of tables in the context.
+int la_reasm_ctx_stats_get(la_reasm_ctx *rctx, la_reasm_table_stats *stats, int max_cnt) {
+	la_assert(rctx != NULL);
+	la_assert(stats != NULL || max_cnt == 0);
+	int cnt = 0;
+	if(rctx->locking) {
+		la_lock_acquire(&rctx->lock);
+	}
+	for(la_list *l = rctx->rtables; l != NULL; l = la_list_next(l), cnt++) {
+		if(cnt < max_cnt) {
+			la_reasm_table_stats_get(l->data, stats + cnt);
+		}
+	}
+	if(rctx->locking) {
+		la_lock_release(&rctx->lock);
+	}
+	return cnt;
+}
+
 // Checks if time difference between rx_first and rx_last is greater than timeout.
 static bool la_reasm_timed_out(struct timeval rx_last, struct timeval rx_first,
 		struct timeval timeout) {
@@ -184,9 +766,9 @@ static bool la_reasm_timed_out(struct timeval rx_last, struct timeval rx_first,
 		.tv_sec = rx_first.tv_sec + timeout.tv_sec,
 		.tv_usec = rx_first.tv_usec + timeout.tv_usec
 	};
-	if(to.tv_usec > 1e9) {
+	if(to.tv_usec >= 1000000) {
 		to.tv_sec++;
-		to.tv_usec -= 1e9;
+		to.tv_usec -= 1000000;
 	}
 	la_debug_print(D_INFO, "rx_first: %lu.%lu to: %lu.%lu rx_last: %lu.%lu\n",
 			rx_first.tv_sec, rx_first.tv_usec, to.tv_sec, to.tv_usec, rx_last.tv_sec, rx_last.tv_usec);
@@ -194,35 +776,258 @@ static bool la_reasm_timed_out(struct timeval rx_last, struct timeval rx_first,
 			(rx_last.tv_sec == to.tv_sec && rx_last.tv_usec > to.tv_usec));
 }
 
-// Callback for la_hash_foreach_remove used during reassembly table cleanups.
-static bool is_rt_entry_expired(void const *keyptr, void const *valptr, void *ctx) {
-	LA_UNUSED(keyptr);
-	la_assert(valptr != NULL);
-	la_assert(ctx != NULL);
+// Returns the first full second at which la_reasm_timed_out() is guaranteed
+// to return true for the given entry.
+static int64_t la_reasm_deadline(struct timeval rx_first, struct timeval timeout) {
+	int64_t sec = (int64_t)rx_first.tv_sec + timeout.tv_sec;
+	int64_t usec = (int64_t)rx_first.tv_usec + timeout.tv_usec;
+	sec += usec / 1000000;
+	return sec + 1;
+}
+
+// Returns the shard holding the reassembly state of the message with the given key
+static la_reasm_shard *la_reasm_shard_get(la_reasm_table *rtable, void const *key) {
+	if(rtable->shard_cnt == 1) {
+		return rtable->shards;
+	}
+	// Multiply by the golden ratio and take the high bits of the product, to avoid
+	// correlation between the shard index and the bucket index within the shard.
+	uint32_t h = rtable->funcs.hash_key(key) * 2654435761u;
+	return rtable->shards + (((uint64_t)h * (uint32_t)rtable->shard_cnt) >> 32);
+}
 
-	la_reasm_table_entry const *rt_entry = valptr;
-	struct timeval *now = ctx;
-	return la_reasm_timed_out(*now, rt_entry->first_frag_rx_time, rt_entry->reasm_timeout);
+static void la_reasm_shard_lock(la_reasm_table *rtable, la_reasm_shard *shard) {
+	if(rtable->locking) {
+		la_lock_acquire(&shard->lock);
+	}
 }
 
-// Removes expired entries from the given reassembly table.
-static void la_reasm_table_cleanup(la_reasm_table *rtable, struct timeval now) {
-	la_assert(rtable != NULL);
-	la_assert(rtable->fragment_table != NULL);
-	int deleted_count = la_hash_foreach_remove(rtable->fragment_table,
-			is_rt_entry_expired, &now);
-	// Avoid compiler warning when DEBUG is off
-	LA_UNUSED(deleted_count);
+static void la_reasm_shard_unlock(la_reasm_table *rtable, la_reasm_shard *shard) {
+	if(rtable->locking) {
+		la_lock_release(&shard->lock);
+	}
+}
+
+// Registers a newly created entry in the timing wheel of the given shard
+static void la_reasm_shard_schedule(la_reasm_shard *shard, la_reasm_table_entry *rt_entry,
+		struct timeval now) {
+	la_reasm_wheel *wheel = &shard->wheel;
+	if(!wheel->started) {
+		wheel->time = now.tv_sec;
+		wheel->started = true;
+	}
+	rt_entry->deadline = la_reasm_deadline(rt_entry->first_frag_rx_time, rt_entry->reasm_timeout);
+	la_reasm_wheel_link(wheel, rt_entry, wheel->time + 1);
+}
+
+// Moves entries from the current slot of the given wheel level to lower levels
+static void la_reasm_wheel_cascade(la_reasm_wheel *wheel, int level) {
+	int slot = (wheel->time >> (LA_REASM_WHEEL_BITS * level)) & LA_REASM_WHEEL_MASK;
+	la_reasm_table_entry *next = NULL;
+	for(la_reasm_table_entry *e = la_reasm_wheel_slot_take(wheel, level, slot); e != NULL; e = next) {
+		next = e->wheel_next;
+		la_reasm_wheel_link(wheel, e, wheel->time);
+	}
+}
+
+// Removes expired entries from the given reassembly table shard.
+// Advances the shard's timing wheel up to the current time, expiring entries
+// from level 0 slots on the way. Empty stretches of the wheel are skipped.
+// Returns the number of expired entries.
+static int la_reasm_shard_cleanup(la_reasm_shard *shard, struct timeval now) {
+	la_assert(shard != NULL);
+	la_assert(shard->fragment_table != NULL);
+	la_reasm_wheel *wheel = &shard->wheel;
+	int64_t target = now.tv_sec;
+	int deleted_count = 0;
+	while(wheel->time < target) {
+		if(wheel->entry_cnt == 0) {
+			wheel->time = target;
+			break;
+		}
+		// Jump straight to the next slot boundary of the lowest non-empty level
+		int64_t next_time = wheel->time + 1;
+		for(int level = 0; level < LA_REASM_WHEEL_LEVELS && wheel->occupied[level] == 0; level++) {
+			int64_t span = (int64_t)1 << (LA_REASM_WHEEL_BITS * (level + 1));
+			next_time = (wheel->time | (span - 1)) + 1;
+		}
+		wheel->time = next_time < target ? next_time : target;
+
+		for(int level = LA_REASM_WHEEL_LEVELS - 1; level > 0; level--) {
+			int64_t span = (int64_t)1 << (LA_REASM_WHEEL_BITS * level);
+			if((wheel->time & (span - 1)) == 0) {
+				la_reasm_wheel_cascade(wheel, level);
+			}
+		}
+
+		la_reasm_table_entry *next = NULL;
+		for(la_reasm_table_entry *e = la_reasm_wheel_slot_take(wheel, 0, wheel->time & LA_REASM_WHEEL_MASK);
+				e != NULL; e = next) {
+			next = e->wheel_next;
+			// Fragments might arrive with non-monotonic timestamps (eg. when
+			// merging multiple feeds), so verify the entry against the actual
+			// time before expiring it.
+			if(la_reasm_timed_out(now, e->first_frag_rx_time, e->reasm_timeout)) {
+				la_assert_se(la_hash_remove(shard->fragment_table, e->key) == true);
+				deleted_count++;
+			} else {
+				la_reasm_wheel_link(wheel, e, wheel->time + 1);
+			}
+		}
+	}
 	la_debug_print(D_INFO, "Expired %d entries\n", deleted_count);
+	shard->expired_cnt += deleted_count;
+	return deleted_count;
 }
 
-#define SEQ_UNINITIALIZED -2
+// Finds the earliest deadline of entries in the wheel. Returns false if the
+// wheel is empty. Slots of each level hold consecutive time ranges, starting
+// from the current slot (level 0) or the one following it (higher levels),
+// so only the first non-empty slot of each level needs to be examined.
+static bool la_reasm_wheel_next_deadline(la_reasm_wheel const *wheel, int64_t *result) {
+	bool found = false;
+	for(int level = 0; level < LA_REASM_WHEEL_LEVELS; level++) {
+		if(wheel->occupied[level] == 0) {
+			continue;
+		}
+		int slot = ((wheel->time >> (LA_REASM_WHEEL_BITS * level)) + (level > 0 ? 1 : 0)) &
+			LA_REASM_WHEEL_MASK;
+		while((wheel->occupied[level] & ((uint64_t)1 << slot)) == 0) {
+			slot = (slot + 1) & LA_REASM_WHEEL_MASK;
+		}
+		for(la_reasm_table_entry *e = wheel->slots[level][slot]; e != NULL; e = e->wheel_next) {
+			if(!found || e->deadline < *result) {
+				*result = e->deadline;
+				found = true;
+			}
+		}
+	}
+	return found;
+}
+
+// Removes entries which have timed out at the given time from all tables
+// of the context. Returns the number of removed entries.
+int la_reasm_ctx_expire(la_reasm_ctx *rctx, struct timeval now) {
+	la_assert(rctx != NULL);
+	la_arena *saved_arena = la_arena_activate(NULL);
+	int expired_cnt = 0;
+	if(rctx->locking) {
+		la_lock_acquire(&rctx->lock);
+	}
+	for(la_list *l = rctx->rtables; l != NULL; l = la_list_next(l)) {
+		la_reasm_table *rtable = l->data;
+		for(int i = 0; i < rtable->shard_cnt; i++) {
+			la_reasm_shard *shard = rtable->shards + i;
+			la_reasm_shard_lock(rtable, shard);
+			expired_cnt += la_reasm_shard_cleanup(shard, now);
+			shard->frag_cnt = 0;
+			la_reasm_shard_unlock(rtable, shard);
+		}
+	}
+	if(rctx->locking) {
+		la_lock_release(&rctx->lock);
+	}
+	la_arena_activate(saved_arena);
+	return expired_cnt;
+}
+
+// Stores the earliest time at which la_reasm_ctx_expire() would remove
+// an entry from the context in *result. Returns false if the context
+// has no entries.
+bool la_reasm_ctx_next_deadline(la_reasm_ctx *rctx, struct timeval *result) {
+	la_assert(rctx != NULL);
+	la_assert(result != NULL);
+	bool found = false;
+	int64_t deadline = 0;
+	if(rctx->locking) {
+		la_lock_acquire(&rctx->lock);
+	}
+	for(la_list *l = rctx->rtables; l != NULL; l = la_list_next(l)) {
+		la_reasm_table *rtable = l->data;
+		for(int i = 0; i < rtable->shard_cnt; i++) {
+			la_reasm_shard *shard = rtable->shards + i;
+			int64_t d = 0;
+			la_reasm_shard_lock(rtable, shard);
+			if(la_reasm_wheel_next_deadline(&shard->wheel, &d) && (!found || d < deadline)) {
+				deadline = d;
+				found = true;
+			}
+			la_reasm_shard_unlock(rtable, shard);
+		}
+	}
+	if(rctx->locking) {
+		la_lock_release(&rctx->lock);
+	}
+	if(found) {
+		result->tv_sec = deadline;
+		result->tv_usec = 0;
+	}
+	return found;
+}
+
+// Returns the part of the table-wide limit applicable to a single shard
+static size_t la_reasm_shard_limit(la_reasm_table const *rtable, size_t limit) {
+	return (limit + rtable->shard_cnt - 1) / rtable->shard_cnt;
+}
+
+static bool la_reasm_shard_over_limits(la_reasm_table *rtable, la_reasm_shard *shard) {
+	la_reasm_ctx *rctx = rtable->rctx;
+	return (rtable->max_entries > 0 && shard->entry_cnt > la_reasm_shard_limit(rtable, rtable->max_entries)) ||
+		(rtable->max_bytes > 0 && shard->byte_cnt > la_reasm_shard_limit(rtable, rtable->max_bytes)) ||
+		(rctx->max_entries > 0 && (uint64_t)la_reasm_usage_get(rctx, &rctx->entry_cnt) > rctx->max_entries) ||
+		(rctx->max_bytes > 0 && (uint64_t)la_reasm_usage_get(rctx, &rctx->byte_cnt) > rctx->max_bytes);
+}
+
+// Evicts least recently used entries from the given shard until table and
+// context limits are met. The entry which has just been updated is never
+// evicted. Context-wide limits are enforced on a best-effort basis - only
+// the shard which is being modified is inspected.
+static void la_reasm_shard_enforce_limits(la_reasm_table *rtable, la_reasm_shard *shard,
+		la_reasm_table_entry const *keep) {
+	while(shard->lru_head != NULL && shard->lru_head != keep &&
+			la_reasm_shard_over_limits(rtable, shard)) {
+		la_reasm_table_entry *victim = shard->lru_head;
+		la_debug_print(D_INFO, "Evicting rt_entry (%zu bytes)\n", victim->byte_cnt);
+		la_assert_se(la_hash_remove(shard->fragment_table, victim->key) == true);
+		shard->evicted_cnt++;
+	}
+}
 
 // Checks if the given sequence number follows the previous one seen.
 static bool is_seq_num_in_sequence(int prev_seq_num, int cur_seq_num) {
 	return (prev_seq_num == SEQ_UNINITIALIZED || prev_seq_num + 1 == cur_seq_num);
 }
 
+// Creates a new entry with the given key in the shard and registers it in
+// the LRU list and in the timing wheel.
+static la_reasm_table_entry *la_reasm_entry_new(la_reasm_shard *shard, void *key,
+		struct timeval first_frag_rx_time, struct timeval reasm_timeout) {
+	la_reasm_table_entry *rt_entry = LA_XCALLOC(1, sizeof(la_reasm_table_entry));
+	rt_entry->prev_seq_num = SEQ_UNINITIALIZED;
+	rt_entry->final_seq_num = SEQ_UNINITIALIZED;
+	rt_entry->first_frag_rx_time = first_frag_rx_time;
+	rt_entry->reasm_timeout = reasm_timeout;
+	rt_entry->shard = shard;
+	shard->entry_cnt++;
+	la_reasm_usage_add(shard->rtable->rctx, &shard->rtable->rctx->entry_cnt, 1);
+	la_reasm_entry_charge(rt_entry, sizeof(la_reasm_table_entry));
+	la_reasm_lru_link(rt_entry);
+	la_hash_insert(shard->fragment_table, key, rt_entry);
+	rt_entry->key = key;
+	la_reasm_shard_schedule(shard, rt_entry, first_frag_rx_time);
+	return rt_entry;
+}
+
+// Accounts a fragment rejected due to invalid arguments. Such fragments
+// are not routed to any particular shard, so they are counted in the first one.
+static la_reasm_status la_reasm_fragment_reject(la_reasm_table *rtable) {
+	la_reasm_shard *shard = rtable->shards;
+	la_reasm_shard_lock(rtable, shard);
+	shard->status_cnt[LA_REASM_ARGS_INVALID]++;
+	la_reasm_shard_unlock(rtable, shard);
+	return LA_REASM_ARGS_INVALID;
+}
+
 // Core reassembly logic.
 // Validates the given message fragment and appends it to the reassembly table
 // fragment list.
@@ -230,26 +1035,29 @@ la_reasm_status la_reasm_fragment_add(la_reasm_table *rtable, la_reasm_fragment_
 	la_assert(rtable != NULL);
 	la_assert(finfo != NULL);
 	if(finfo->msg_info == NULL) {
-		return LA_REASM_ARGS_INVALID;
+		return la_reasm_fragment_reject(rtable);
 	}
 
 	// Don't allow zero timeout. This would prevent stale rt_entries from being expired,
 	// causing a massive memory leak.
 
 	if(finfo->reasm_timeout.tv_sec == 0 && finfo->reasm_timeout.tv_usec == 0) {
-		return LA_REASM_ARGS_INVALID;
+		return la_reasm_fragment_reject(rtable);
 	}
 
 	if(finfo->flags & LA_ALLOW_OUT_OF_ORDER_DELIVERY && finfo->seq_num_wrap != SEQ_WRAP_NONE) {
-		return LA_REASM_ARGS_INVALID;
+		return la_reasm_fragment_reject(rtable);
 	}
 
 	la_reasm_status ret = LA_REASM_UNKNOWN;
-	void *lookup_key = rtable->funcs.get_tmp_key(finfo->msg_info);
-	la_assert(lookup_key != NULL);
+	la_arena *saved_arena = la_arena_activate(NULL);
+	la_reasm_tmp_key_storage tmp_key_storage;
+	void *lookup_key = la_reasm_tmp_key_get(rtable, finfo->msg_info, &tmp_key_storage);
+	la_reasm_shard *shard = la_reasm_shard_get(rtable, lookup_key);
+	la_reasm_shard_lock(rtable, shard);
 	la_reasm_table_entry *rt_entry = NULL;
 restart:
-	rt_entry = la_hash_lookup(rtable->fragment_table, lookup_key);
+	rt_entry = la_hash_lookup(shard->fragment_table, lookup_key);
 	if(rt_entry == NULL) {
 
 		if(finfo->flags & LA_ALLOW_OUT_OF_ORDER_DELIVERY) {
@@ -264,6 +1072,15 @@ restart:
 				ret = LA_REASM_SKIPPED;
 				goto end;
 			}
+			if((finfo->flags & LA_REQUIRE_FIRST_FRAGMENT) &&
+					finfo->seq_num_first != SEQ_FIRST_NONE &&
+					finfo->seq_num_first != finfo->seq_num) {
+				la_debug_print(D_INFO, "No rt_entry found, first fragment is required and "
+						"seq_num %d != seq_num_first %d, not creating rt_entry\n",
+						finfo->seq_num, finfo->seq_num_first);
+				ret = LA_REASM_FRAG_OUT_OF_SEQUENCE;
+				goto end;
+			}
 
 		} else {
 
@@ -287,23 +1104,18 @@ restart:
 				goto end;
 			}
 		}
-		rt_entry = LA_XCALLOC(1, sizeof(la_reasm_table_entry));
-		rt_entry->prev_seq_num = SEQ_UNINITIALIZED;
-		rt_entry->first_frag_rx_time = finfo->rx_time;
-		rt_entry->reasm_timeout = finfo->reasm_timeout;
+		void *msg_key = rtable->funcs.get_key(finfo->msg_info);
+		la_assert(msg_key != NULL);
+		rt_entry = la_reasm_entry_new(shard, msg_key, finfo->rx_time, finfo->reasm_timeout);
+		rt_entry->out_of_order = (finfo->flags & LA_ALLOW_OUT_OF_ORDER_DELIVERY) != 0;
 		if(finfo->total_pdu_len > 0) {
 			rt_entry->total_pdu_len = finfo->total_pdu_len;
 		} else if(finfo->total_fragment_cnt > 0) {
 			rt_entry->total_fragment_cnt = finfo->total_fragment_cnt;
 		}
-		rt_entry->frags_collected_total_len = 0;
-		rt_entry->frags_collected_cnt = 0;
 		la_debug_print(D_INFO, "Adding new rt_table entry (rx_time: %lu.%lu timeout: %lu.%lu)\n",
 				rt_entry->first_frag_rx_time.tv_sec, rt_entry->first_frag_rx_time.tv_usec,
 				rt_entry->reasm_timeout.tv_sec, rt_entry->reasm_timeout.tv_usec);
-		void *msg_key = rtable->funcs.get_key(finfo->msg_info);
-		la_assert(msg_key != NULL);
-		la_hash_insert(rtable->fragment_table, msg_key, rt_entry);
 	} else {
 		la_debug_print(D_INFO, "rt_entry found, prev_seq_num: %d\n", rt_entry->prev_seq_num);
 	}
@@ -329,7 +1141,8 @@ restart:
 		// a new message. Remove the old rt_entry and create new one.
 
 		la_debug_print(D_INFO, "reasm timeout expired; creating new rt_entry\n");
-		la_hash_remove(rtable->fragment_table, lookup_key);
+		la_hash_remove(shard->fragment_table, lookup_key);
+		shard->expired_cnt++;
 		goto restart;
 	}
 
@@ -337,7 +1150,7 @@ restart:
 
 	bool is_duplicate = false;
 	if(finfo->flags & LA_ALLOW_OUT_OF_ORDER_DELIVERY) {
-		is_duplicate = la_reasm_fragment_seq_num_already_exists(rt_entry->fragment_list, finfo->seq_num);
+		is_duplicate = la_reasm_fragment_seq_num_already_exists(rt_entry, finfo->seq_num);
 	} else {
 		// If out-of-order delivery is not allowed, then we may use a simplified
 		// check for duplicates.
@@ -361,22 +1174,26 @@ restart:
 
 		la_debug_print(D_INFO, "seq_num %d out of sequence (prev: %d)\n",
 				finfo->seq_num, rt_entry->prev_seq_num);
-		la_hash_remove(rtable->fragment_table, lookup_key);
+		la_hash_remove(shard->fragment_table, lookup_key);
 		ret = LA_REASM_FRAG_OUT_OF_SEQUENCE;
 		goto end;
 	}
 
-	// All checks succeeded. Add the fragment to the list.
-	// If out-of-order delivery is allowed, keep the fragment list sorted by seq_num.
-	// Otherwise just append it at the end of the list - this is simpler and also
-	// works correctly if seq_num may wrap - sorted insert wouldn't work then.
+	// All checks succeeded. Append the fragment payload to the buffer.
+	// If out-of-order delivery is allowed, record its location in the index
+	// sorted by seq_num. Otherwise fragments are stored in the buffer in
+	// sequence - this is simpler and also works correctly if seq_num may wrap -
+	// sorted insert wouldn't work then.
 
-	la_reasm_fragment *fragment = la_reasm_fragment_new(finfo->seq_num, finfo->msg_data, finfo->msg_data_len);
+	int msg_data_len = finfo->msg_data_len > 0 ? finfo->msg_data_len : 0;
+	la_reasm_entry_append(rt_entry, finfo->msg_data, msg_data_len);
 	if(finfo->flags & LA_ALLOW_OUT_OF_ORDER_DELIVERY) {
 		la_debug_print(D_INFO, "Good seq_num %d, adding fragment to the list\n",
 				finfo->seq_num);
-		rt_entry->fragment_list = la_list_insert_sorted(rt_entry->fragment_list, fragment,
-				la_reasm_compare_fragment_seq_numbers);
+		la_reasm_entry_index_add(rt_entry, finfo->seq_num, msg_data_len);
+		if(finfo->is_final_fragment) {
+			rt_entry->final_seq_num = finfo->seq_num;
+		}
 		// total_pdu_len or total_fragment_cnt values might be contained in the
 		// first fragment only (like msg_total attribute in OHMA). If the first
 		// fragment received was not the first fragment of the message, then
@@ -391,11 +1208,12 @@ restart:
 	} else {
 		la_debug_print(D_INFO, "Good seq_num %d (prev: %d), adding fragment to the list\n",
 				finfo->seq_num, rt_entry->prev_seq_num);
-			rt_entry->fragment_list = la_list_append(rt_entry->fragment_list, fragment);
 		rt_entry->prev_seq_num = finfo->seq_num;
 	}
-	rt_entry->frags_collected_total_len += finfo->msg_data_len;
+	rt_entry->frags_collected_total_len += msg_data_len;
 	rt_entry->frags_collected_cnt++;
+	la_reasm_lru_touch(rt_entry);
+	la_reasm_shard_enforce_limits(rtable, shard, rt_entry);
 
 	// If we've come to this point successfully, then reassembly is complete if:
 	//
@@ -410,74 +1228,575 @@ restart:
 	//
 	// Otherwise we expect more fragments to come.
 	//
-	// XXX: when out-of-order delivery is allowed, we probably should verify
-	// whether seq_nums of collected fragments form a contiguous sequence,
-	// however the only protocol which currently uses this mode of reassembly
-	// is OHMA, for which total_fragment_cnt check is good enough.
+	// When out-of-order delivery is allowed, seq_nums of collected fragments
+	// must also form a contiguous sequence.
 
-	if(rt_entry->total_pdu_len > 0) {
+	if((finfo->flags & LA_ALLOW_OUT_OF_ORDER_DELIVERY) &&
+			!la_reasm_fragment_sequence_is_complete(rt_entry, finfo->seq_num_first)) {
+		ret = LA_REASM_IN_PROGRESS;
+	} else if(rt_entry->total_pdu_len > 0) {
 		ret = rt_entry->frags_collected_total_len >= rt_entry->total_pdu_len ?
 			LA_REASM_COMPLETE : LA_REASM_IN_PROGRESS;
 	} else if(rt_entry->total_fragment_cnt > 0) {
 		ret = rt_entry->frags_collected_cnt >= rt_entry->total_fragment_cnt ?
 			LA_REASM_COMPLETE : LA_REASM_IN_PROGRESS;
+	} else if(finfo->flags & LA_ALLOW_OUT_OF_ORDER_DELIVERY) {
+		ret = rt_entry->final_seq_num != SEQ_UNINITIALIZED ? LA_REASM_COMPLETE : LA_REASM_IN_PROGRESS;
 	} else {
 		ret = finfo->is_final_fragment ? LA_REASM_COMPLETE : LA_REASM_IN_PROGRESS;
 	}
+	if(ret == LA_REASM_COMPLETE) {
+		shard->completed_frags_cnt += rt_entry->frags_collected_cnt;
+	}
 
 end:
+	shard->status_cnt[ret]++;
 
 	// Update fragment counter and expire old entries if necessary.
 	// Expiration is performed in relation to rx_time of the fragment currently
 	// being processed. This allows processing historical data with timestamps in
 	// the past.
 
-	if(++rtable->frag_cnt > rtable->cleanup_interval) {
-		la_reasm_table_cleanup(rtable, finfo->rx_time);
-		rtable->frag_cnt = 0;
+	if(++shard->frag_cnt > rtable->cleanup_interval) {
+		la_reasm_shard_cleanup(shard, finfo->rx_time);
+		shard->frag_cnt = 0;
 	}
+	la_reasm_shard_unlock(rtable, shard);
 	la_debug_print(D_INFO, "Result: %d\n", ret);
-	LA_XFREE(lookup_key);
+	la_reasm_tmp_key_release(rtable, lookup_key);
+	la_arena_activate(saved_arena);
 	return ret;
 }
 
+// Fragment storage taken over from a reassembly table entry
+typedef struct {
+	uint8_t *buf;
+	int len;
+	la_reasm_fragment *index;
+	int index_len;
+} la_reasm_storage;
+
+// Removes the packet data from reassembly table and takes over its fragment
+// storage. Returns the length of the payload (the packet data is left intact
+// if it's zero) or -1 if the packet is not in the table.
+static int la_reasm_storage_take(la_reasm_table *rtable, void const *msg_info,
+		la_reasm_storage *storage) {
+	la_reasm_tmp_key_storage tmp_key_storage;
+	void *tmp_key = la_reasm_tmp_key_get(rtable, msg_info, &tmp_key_storage);
+
+	int result_len = -1;
+	la_reasm_shard *shard = la_reasm_shard_get(rtable, tmp_key);
+	la_reasm_shard_lock(rtable, shard);
+	la_reasm_table_entry *rt_entry = la_hash_lookup(shard->fragment_table, tmp_key);
+	if(rt_entry == NULL) {
+		result_len = -1;
+		goto end;
+	}
+	if(rt_entry->frags_collected_total_len < 1) {
+		result_len = 0;
+		goto end;
+	}
+	*storage = (la_reasm_storage){
+		.buf = rt_entry->buf,
+		.len = rt_entry->frags_collected_total_len,
+		.index = rt_entry->index,
+		.index_len = rt_entry->index_len
+	};
+	rt_entry->buf = NULL;
+	rt_entry->index = NULL;
+	result_len = storage->len;
+	la_hash_remove(shard->fragment_table, tmp_key);
+end:
+	la_reasm_shard_unlock(rtable, shard);
+	la_reasm_tmp_key_release(rtable, tmp_key);
+	return result_len;
+}
+
+// Checks that all fragments listed in the index lie within the buffer
+// and that they do not add up to more than the payload length.
+static bool la_reasm_storage_is_valid(la_reasm_storage const *storage) {
+	int64_t total_len = 0;
+	for(int i = 0; i < storage->index_len; i++) {
+		la_reasm_fragment const *f = storage->index + i;
+		if(f->offset < 0 || f->len < 0 || f->offset > storage->len ||
+				f->len > storage->len - f->offset) {
+			return false;
+		}
+		total_len += f->len;
+	}
+	return total_len <= storage->len;
+}
+
+static void la_reasm_storage_release(la_reasm_storage *storage) {
+	LA_XFREE(storage->buf);
+	LA_XFREE(storage->index);
+}
+
 // Returns the reassembled payload and removes the packet data from reassembly table
 int la_reasm_payload_get(la_reasm_table *rtable, void const *msg_info, uint8_t **result) {
 	la_assert(rtable != NULL);
 	la_assert(msg_info != NULL);
 	la_assert(result != NULL);
 
-	void *tmp_key = rtable->funcs.get_tmp_key(msg_info);
-	la_assert(tmp_key);
+	la_reasm_storage storage;
+	int result_len = la_reasm_storage_take(rtable, msg_info, &storage);
+	if(result_len < 1) {
+		return result_len;
+	}
+	if(!la_reasm_storage_is_valid(&storage)) {
+		la_debug_print(D_ERROR, "fragment index does not match the payload\n");
+		la_reasm_storage_release(&storage);
+		return -1;
+	}
+	// Fragments are already stored in sequence, unless they have arrived out of
+	// order. In the former case the buffer is handed over to the caller as is.
+	// The result is a part of the decoded message, so it must be copied to the
+	// arena, if one is active.
+	uint8_t *reasm_buf = NULL;
+	if(!la_reasm_fragments_are_contiguous(storage.index, storage.index_len)) {
+		reasm_buf = LA_XCALLOC(storage.len + 1, sizeof(uint8_t));
+		uint8_t *ptr = reasm_buf;
+		for(int i = 0; i < storage.index_len; i++) {
+			memcpy(ptr, storage.buf + storage.index[i].offset, storage.index[i].len);
+			ptr += storage.index[i].len;
+		}
+		LA_XFREE(storage.buf);
+	} else if(la_arena_current() != NULL) {
+		reasm_buf = LA_XCALLOC(storage.len + 1, sizeof(uint8_t));
+		memcpy(reasm_buf, storage.buf, storage.len);
+		LA_XFREE(storage.buf);
+	} else {
+		reasm_buf = storage.buf;
+	}
+	// Append a NULL byte at the end of the reassembled buffer, so that it can be
+	// cast to char * if this is a text message. The fragment buffer always has
+	// a spare byte for it.
+	reasm_buf[storage.len] = '\0';
+	LA_XFREE(storage.index);
+	*result = reasm_buf;
+	return result_len;
+}
 
-	size_t result_len = -1;
-	la_reasm_table_entry *rt_entry = la_hash_lookup(rtable->fragment_table, tmp_key);
-	if(rt_entry == NULL) {
-		result_len = -1;
-		goto end;
+// Same as la_reasm_payload_get(), but instead of concatenating fragments,
+// returns the locations of their payloads in sequence order. Adjacent
+// payloads are merged into a single iovec.
+int la_reasm_payload_get_iov(la_reasm_table *rtable, void const *msg_info,
+		la_reasm_payload *result) {
+	la_assert(rtable != NULL);
+	la_assert(msg_info != NULL);
+	la_assert(result != NULL);
+
+	la_reasm_storage storage;
+	int result_len = la_reasm_storage_take(rtable, msg_info, &storage);
+	if(result_len < 1) {
+		return result_len;
 	}
-	if(rt_entry->frags_collected_total_len < 1) {
-		result_len = 0;
+	if(!la_reasm_storage_is_valid(&storage)) {
+		la_debug_print(D_ERROR, "fragment index does not match the payload\n");
+		la_reasm_storage_release(&storage);
+		return -1;
+	}
+	la_arena *saved_arena = la_arena_activate(NULL);
+	int max_cnt = storage.index_len > 0 ? storage.index_len : 1;
+	la_reasm_iovec *iov = LA_XCALLOC(max_cnt, sizeof(la_reasm_iovec));
+	int iov_cnt = 0;
+	if(storage.index_len == 0) {
+		iov[iov_cnt++] = (la_reasm_iovec){ .base = storage.buf, .len = storage.len };
+	} else {
+		for(int i = 0; i < storage.index_len; i++) {
+			uint8_t const *base = storage.buf + storage.index[i].offset;
+			if(iov_cnt > 0 && iov[iov_cnt-1].base + iov[iov_cnt-1].len == base) {
+				iov[iov_cnt-1].len += storage.index[i].len;
+			} else {
+				iov[iov_cnt++] = (la_reasm_iovec){ .base = base, .len = storage.index[i].len };
+			}
+		}
+	}
+	LA_XFREE(storage.index);
+	la_arena_activate(saved_arena);
+	*result = (la_reasm_payload){
+		.iov = iov,
+		.iov_cnt = iov_cnt,
+		.len = storage.len,
+		.storage = storage.buf
+	};
+	return result_len;
+}
+
+// Releases memory held by the payload returned by la_reasm_payload_get_iov()
+void la_reasm_payload_release(la_reasm_payload *payload) {
+	if(payload == NULL) {
+		return;
+	}
+	LA_XFREE(payload->iov);
+	LA_XFREE(payload->storage);
+	payload->iov_cnt = 0;
+	payload->len = 0;
+}
+
+/********************************************************************************
+ * Reassembly context snapshots
+ ********************************************************************************/
+
+// Snapshot format (all integers are little endian):
+//
+// magic "LARS", version (u8), number of tables (u32), then for each table:
+//   name length (u16), name, number of entries (u32), then for each entry:
+//     key length (u32), serialized key,
+//     first_frag_rx_time (i64 sec, u32 usec), reasm_timeout (i64 sec, u32 usec),
+//     prev_seq_num, final_seq_num, total_pdu_len, total_fragment_cnt,
+//     frags_collected_cnt (i32 each), flags (u8),
+//     payload length (u32), payload,
+//     fragment index length (u32), then for each fragment:
+//       seq_num (i32), offset (u32), length (u32)
+//
+// Entries of each table are stored from the least to the most recently used.
+
+#define LA_REASM_SNAPSHOT_MAGIC "LARS"
+#define LA_REASM_SNAPSHOT_VERSION 2
+
+// Entry flags
+#define LA_REASM_SNAPSHOT_ENTRY_OUT_OF_ORDER (1 << 0)
+
+typedef struct {
+	uint8_t *buf;
+	size_t len;
+	size_t size;
+} la_reasm_writer;
+
+static uint8_t *la_reasm_writer_reserve(la_reasm_writer *w, size_t len) {
+	if(w->len + len > w->size) {
+		size_t new_size = w->size > 0 ? w->size * 2 : 4096;
+		while(new_size < w->len + len) {
+			new_size *= 2;
+		}
+		w->buf = LA_XREALLOC(w->buf, new_size);
+		w->size = new_size;
+	}
+	uint8_t *ptr = w->buf + w->len;
+	w->len += len;
+	return ptr;
+}
+
+static void la_reasm_put_le(uint8_t *ptr, uint64_t val, int len) {
+	for(int i = 0; i < len; i++) {
+		ptr[i] = (val >> (8 * i)) & 0xff;
+	}
+}
+
+static void la_reasm_write_int(la_reasm_writer *w, uint64_t val, int len) {
+	la_reasm_put_le(la_reasm_writer_reserve(w, len), val, len);
+}
+
+static void la_reasm_write_bytes(la_reasm_writer *w, void const *data, size_t len) {
+	if(len > 0) {
+		memcpy(la_reasm_writer_reserve(w, len), data, len);
+	}
+}
+
+typedef struct {
+	uint8_t const *buf;
+	size_t len;
+	size_t pos;
+	bool err;
+} la_reasm_reader;
+
+static uint8_t const *la_reasm_read_bytes(la_reasm_reader *r, size_t len) {
+	if(r->err || len > r->len - r->pos) {
+		r->err = true;
+		return NULL;
+	}
+	uint8_t const *ptr = r->buf + r->pos;
+	r->pos += len;
+	return ptr;
+}
+
+static uint64_t la_reasm_read_int(la_reasm_reader *r, int len) {
+	uint8_t const *ptr = la_reasm_read_bytes(r, len);
+	uint64_t val = 0;
+	if(ptr != NULL) {
+		for(int i = len - 1; i >= 0; i--) {
+			val = (val << 8) | ptr[i];
+		}
+	}
+	return val;
+}
+
+static void la_reasm_entry_save(la_reasm_writer *w, la_reasm_table const *rtable,
+		la_reasm_table_entry const *rt_entry) {
+	size_t key_len = rtable->funcs.serialize_key(rt_entry->key, NULL, 0);
+	la_reasm_write_int(w, key_len, 4);
+	uint8_t *key_buf = la_reasm_writer_reserve(w, key_len);
+	la_assert_se(rtable->funcs.serialize_key(rt_entry->key, key_buf, key_len) == key_len);
+
+	la_reasm_write_int(w, (int64_t)rt_entry->first_frag_rx_time.tv_sec, 8);
+	la_reasm_write_int(w, rt_entry->first_frag_rx_time.tv_usec, 4);
+	la_reasm_write_int(w, (int64_t)rt_entry->reasm_timeout.tv_sec, 8);
+	la_reasm_write_int(w, rt_entry->reasm_timeout.tv_usec, 4);
+	la_reasm_write_int(w, (uint32_t)rt_entry->prev_seq_num, 4);
+	la_reasm_write_int(w, (uint32_t)rt_entry->final_seq_num, 4);
+	la_reasm_write_int(w, (uint32_t)rt_entry->total_pdu_len, 4);
+	la_reasm_write_int(w, (uint32_t)rt_entry->total_fragment_cnt, 4);
+	la_reasm_write_int(w, (uint32_t)rt_entry->frags_collected_cnt, 4);
+	la_reasm_write_int(w, rt_entry->out_of_order ? LA_REASM_SNAPSHOT_ENTRY_OUT_OF_ORDER : 0, 1);
+	la_reasm_write_int(w, rt_entry->frags_collected_total_len, 4);
+	la_reasm_write_bytes(w, rt_entry->buf, rt_entry->frags_collected_total_len);
+	la_reasm_write_int(w, rt_entry->index_len, 4);
+	for(int i = 0; i < rt_entry->index_len; i++) {
+		la_reasm_write_int(w, (uint32_t)rt_entry->index[i].seq_num, 4);
+		la_reasm_write_int(w, rt_entry->index[i].offset, 4);
+		la_reasm_write_int(w, rt_entry->index[i].len, 4);
+	}
+}
+
+// Serializes all entries of all named reassembly tables in the context into
+// a newly allocated buffer. Returns the length of the buffer.
+size_t la_reasm_ctx_save(la_reasm_ctx *rctx, uint8_t **result) {
+	la_assert(rctx != NULL);
+	la_assert(result != NULL);
+
+	la_arena *saved_arena = la_arena_activate(NULL);
+	la_reasm_writer w = { 0 };
+	la_reasm_write_bytes(&w, LA_REASM_SNAPSHOT_MAGIC, strlen(LA_REASM_SNAPSHOT_MAGIC));
+	la_reasm_write_int(&w, LA_REASM_SNAPSHOT_VERSION, 1);
+	size_t table_cnt_pos = w.len;
+	la_reasm_write_int(&w, 0, 4);
+	uint32_t table_cnt = 0;
+
+	if(rctx->locking) {
+		la_lock_acquire(&rctx->lock);
+	}
+	for(la_list *l = rctx->rtables; l != NULL; l = la_list_next(l)) {
+		la_reasm_table *rtable = l->data;
+		if(rtable->funcs.name == NULL || rtable->funcs.serialize_key == NULL) {
+			continue;
+		}
+		size_t name_len = strlen(rtable->funcs.name);
+		la_reasm_write_int(&w, name_len, 2);
+		la_reasm_write_bytes(&w, rtable->funcs.name, name_len);
+		size_t entry_cnt_pos = w.len;
+		la_reasm_write_int(&w, 0, 4);
+		uint32_t entry_cnt = 0;
+		for(int i = 0; i < rtable->shard_cnt; i++) {
+			la_reasm_shard *shard = rtable->shards + i;
+			la_reasm_shard_lock(rtable, shard);
+			for(la_reasm_table_entry *e = shard->lru_head; e != NULL; e = e->lru_next) {
+				la_reasm_entry_save(&w, rtable, e);
+				entry_cnt++;
+			}
+			la_reasm_shard_unlock(rtable, shard);
+		}
+		la_reasm_put_le(w.buf + entry_cnt_pos, entry_cnt, 4);
+		table_cnt++;
+	}
+	if(rctx->locking) {
+		la_lock_release(&rctx->lock);
+	}
+	la_reasm_put_le(w.buf + table_cnt_pos, table_cnt, 4);
+	la_arena_activate(saved_arena);
+	*result = w.buf;
+	return w.len;
+}
+
+static struct {
+	char const *name;
+	la_reasm_table *(*get)(la_reasm_ctx *rctx);
+} const la_reasm_builtin_tables[] = {
+	{ .name = "acars",      .get = la_acars_reasm_table_get },
+	{ .name = "miam_file",  .get = la_miam_file_reasm_table_get },
+#ifdef WITH_JANSSON
+	{ .name = "ohma",       .get = la_ohma_reasm_table_get },
+#endif
+};
+
+// Returns the table with the given name. Tables used by libacars decoders
+// are created if they do not exist yet.
+static la_reasm_table *la_reasm_table_get_by_name(la_reasm_ctx *rctx, char const *name,
+		size_t name_len) {
+	la_reasm_table *rtable = NULL;
+	if(rctx->locking) {
+		la_lock_acquire(&rctx->lock);
+	}
+	for(la_list *l = rctx->rtables; l != NULL; l = la_list_next(l)) {
+		la_reasm_table *rt = l->data;
+		if(rt->funcs.name != NULL && strlen(rt->funcs.name) == name_len &&
+				!memcmp(rt->funcs.name, name, name_len)) {
+			rtable = rt;
+			break;
+		}
+	}
+	if(rctx->locking) {
+		la_lock_release(&rctx->lock);
+	}
+	if(rtable != NULL) {
+		return rtable;
+	}
+	for(size_t i = 0; i < sizeof(la_reasm_builtin_tables) / sizeof(la_reasm_builtin_tables[0]); i++) {
+		if(strlen(la_reasm_builtin_tables[i].name) == name_len &&
+				!memcmp(la_reasm_builtin_tables[i].name, name, name_len)) {
+			return la_reasm_builtin_tables[i].get(rctx);
+		}
+	}
+	return NULL;
+}
+
+static int la_reasm_fragment_offset_compare(void const *a, void const *b) {
+	la_reasm_fragment const *fa = a, *fb = b;
+	return fa->offset < fb->offset ? -1 : fa->offset > fb->offset;
+}
+
+// Returns true if the fragments listed in the index fill the payload buffer
+// exactly, without overlaps or gaps. The index is sorted by seq_num, while
+// the payloads are stored in order of arrival, hence a copy sorted by offset
+// is checked.
+static bool la_reasm_index_covers_payload(la_reasm_fragment const *index, uint32_t index_len,
+		uint32_t payload_len) {
+	la_reasm_fragment *sorted = LA_XCALLOC(index_len, sizeof(la_reasm_fragment));
+	memcpy(sorted, index, index_len * sizeof(la_reasm_fragment));
+	qsort(sorted, index_len, sizeof(la_reasm_fragment), la_reasm_fragment_offset_compare);
+	uint32_t expected_offset = 0;
+	bool result = true;
+	for(uint32_t i = 0; i < index_len && result; i++) {
+		result = (uint32_t)sorted[i].offset == expected_offset;
+		expected_offset += (uint32_t)sorted[i].len;
+	}
+	LA_XFREE(sorted);
+	return result && expected_offset == payload_len;
+}
+
+// Reads a single entry from the snapshot and adds it to the table (if it's
+// not NULL). Returns true if the entry has been restored.
+static bool la_reasm_entry_load(la_reasm_reader *r, la_reasm_table *rtable) {
+	size_t key_len = la_reasm_read_int(r, 4);
+	uint8_t const *key_buf = la_reasm_read_bytes(r, key_len);
+	struct timeval first_frag_rx_time, reasm_timeout;
+	first_frag_rx_time.tv_sec = (int64_t)la_reasm_read_int(r, 8);
+	first_frag_rx_time.tv_usec = la_reasm_read_int(r, 4);
+	reasm_timeout.tv_sec = (int64_t)la_reasm_read_int(r, 8);
+	reasm_timeout.tv_usec = la_reasm_read_int(r, 4);
+	int prev_seq_num = (int32_t)la_reasm_read_int(r, 4);
+	int final_seq_num = (int32_t)la_reasm_read_int(r, 4);
+	int total_pdu_len = (int32_t)la_reasm_read_int(r, 4);
+	int total_fragment_cnt = (int32_t)la_reasm_read_int(r, 4);
+	int frags_collected_cnt = (int32_t)la_reasm_read_int(r, 4);
+	bool out_of_order = (la_reasm_read_int(r, 1) & LA_REASM_SNAPSHOT_ENTRY_OUT_OF_ORDER) != 0;
+	uint32_t payload_len = la_reasm_read_int(r, 4);
+	uint8_t const *payload = la_reasm_read_bytes(r, payload_len);
+	uint32_t index_len = la_reasm_read_int(r, 4);
+	uint8_t const *index_buf = la_reasm_read_bytes(r, (size_t)index_len * 12);
+	// Only entries of out of order reassemblies have a fragment index
+	if(r->err || payload_len > INT32_MAX || index_len > INT32_MAX / sizeof(la_reasm_fragment) ||
+			(!out_of_order && index_len > 0)) {
+		r->err = true;
+		return false;
+	}
+	if(rtable == NULL || rtable->funcs.deserialize_key == NULL) {
+		return false;
+	}
+	la_reasm_reader ir = { .buf = index_buf, .len = (size_t)index_len * 12 };
+	la_reasm_fragment *index = NULL;
+	if(index_len > 0) {
+		index = LA_XCALLOC(index_len, sizeof(la_reasm_fragment));
+		for(uint32_t i = 0; i < index_len; i++) {
+			index[i].seq_num = (int32_t)la_reasm_read_int(&ir, 4);
+			uint32_t offset = la_reasm_read_int(&ir, 4);
+			uint32_t len = la_reasm_read_int(&ir, 4);
+			// The index must be sorted by seq_num and must not contain duplicates
+			if(offset > payload_len || len > payload_len - offset ||
+					(i > 0 && index[i].seq_num <= index[i-1].seq_num)) {
+				LA_XFREE(index);
+				r->err = true;
+				return false;
+			}
+			index[i].offset = offset;
+			index[i].len = len;
+		}
+		if(!la_reasm_index_covers_payload(index, index_len, payload_len)) {
+			LA_XFREE(index);
+			r->err = true;
+			return false;
+		}
+	} else if(out_of_order && payload_len > 0) {
+		r->err = true;
+		return false;
+	}
+	void *key = rtable->funcs.deserialize_key(key_buf, key_len);
+	if(key == NULL) {
+		LA_XFREE(index);
+		return false;
+	}
+
+	la_reasm_shard *shard = la_reasm_shard_get(rtable, key);
+	la_reasm_shard_lock(rtable, shard);
+	// Do not overwrite reassemblies which are already in progress
+	if(la_hash_lookup(shard->fragment_table, key) != NULL) {
+		la_reasm_shard_unlock(rtable, shard);
+		rtable->funcs.destroy_key(key);
+		LA_XFREE(index);
+		return false;
+	}
+	la_reasm_table_entry *rt_entry = la_reasm_entry_new(shard, key, first_frag_rx_time, reasm_timeout);
+	rt_entry->prev_seq_num = prev_seq_num;
+	rt_entry->final_seq_num = final_seq_num;
+	rt_entry->total_pdu_len = total_pdu_len;
+	rt_entry->total_fragment_cnt = total_fragment_cnt;
+	rt_entry->frags_collected_cnt = frags_collected_cnt;
+	rt_entry->out_of_order = out_of_order;
+	la_reasm_entry_append(rt_entry, payload, payload_len);
+	rt_entry->frags_collected_total_len = payload_len;
+	if(index != NULL) {
+		rt_entry->index = index;
+		rt_entry->index_len = rt_entry->index_size = index_len;
+		la_reasm_entry_charge(rt_entry, index_len * sizeof(la_reasm_fragment));
+		for(uint32_t i = 0; i < index_len; i++) {
+			la_reasm_seq_bitmap_set(rt_entry, index[i].seq_num);
+		}
+	}
+	la_reasm_shard_enforce_limits(rtable, shard, rt_entry);
+	la_reasm_shard_unlock(rtable, shard);
+	return true;
+}
+
+// Restores entries from a snapshot created with la_reasm_ctx_save().
+// Returns the number of restored entries or -1 if the snapshot is malformed.
+int la_reasm_ctx_load(la_reasm_ctx *rctx, uint8_t const *buf, size_t len) {
+	la_assert(rctx != NULL);
+	la_assert(buf != NULL);
+
+	la_arena *saved_arena = la_arena_activate(NULL);
+	int restored_cnt = 0;
+	la_reasm_reader r = { .buf = buf, .len = len };
+	uint8_t const *magic = la_reasm_read_bytes(&r, strlen(LA_REASM_SNAPSHOT_MAGIC));
+	if(magic == NULL || memcmp(magic, LA_REASM_SNAPSHOT_MAGIC, strlen(LA_REASM_SNAPSHOT_MAGIC)) != 0 ||
+			la_reasm_read_int(&r, 1) != LA_REASM_SNAPSHOT_VERSION) {
+		la_debug_print(D_ERROR, "Not a reassembly snapshot or unsupported version\n");
+		restored_cnt = -1;
 		goto end;
 	}
-	// Append a NULL byte at the end of the reassembled buffer, so that it can be
-	// cast to char * if this is a text message.
-	uint8_t *reasm_buf = LA_XCALLOC(rt_entry->frags_collected_total_len + 1, sizeof(uint8_t));
-	uint8_t *ptr = reasm_buf;
-	for(la_list *l = rt_entry->fragment_list; l != NULL; l = la_list_next(l)) {
-		la_reasm_fragment *fragment = l->data;
-		if(fragment->payload.buf != NULL && fragment->payload.len > 0) {
-			memcpy(ptr, fragment->payload.buf, fragment->payload.len);
+	uint32_t table_cnt = la_reasm_read_int(&r, 4);
+	for(uint32_t t = 0; t < table_cnt && !r.err; t++) {
+		size_t name_len = la_reasm_read_int(&r, 2);
+		char const *name = (char const *)la_reasm_read_bytes(&r, name_len);
+		uint32_t entry_cnt = la_reasm_read_int(&r, 4);
+		if(r.err) {
+			break;
+		}
+		la_reasm_table *rtable = la_reasm_table_get_by_name(rctx, name, name_len);
+		la_debug_print(D_INFO, "Table %.*s: %u entries%s\n", (int)name_len, name, entry_cnt,
+				rtable == NULL ? " (unknown table, skipping)" : "");
+		for(uint32_t e = 0; e < entry_cnt && !r.err; e++) {
+			if(la_reasm_entry_load(&r, rtable)) {
+				restored_cnt++;
+			}
 		}
-		ptr += fragment->payload.len;
 	}
-	reasm_buf[rt_entry->frags_collected_total_len] = '\0'; // buffer len is frags_collected_total_len + 1
-	*result = reasm_buf;
-	result_len = rt_entry->frags_collected_total_len;
-	la_hash_remove(rtable->fragment_table, tmp_key);
+	if(r.err) {
+		la_debug_print(D_ERROR, "Snapshot truncated or malformed at offset %zu\n", r.pos);
+		restored_cnt = -1;
+	}
 end:
-	LA_XFREE(tmp_key);
-	return result_len;
+	la_arena_activate(saved_arena);
+	return restored_cnt;
 }
 
 char const *la_reasm_status_name_get(la_reasm_status status) {
@@ -10,12 +10,15 @@
 extern "C" {
 #endif
 #include <stdbool.h>
+#include <stddef.h>                         // size_t
+#include <stdint.h>                         // uint64_t
 #ifndef _MSC_VER
 #include <sys/time.h>
 #else
 #include <winsock.h>
 #endif
 #include <libacars/hash.h>
+#include <libacars/libacars.h>              // la_config_snapshot
 
 typedef struct la_reasm_ctx_s la_reasm_ctx;
 typedef struct la_reasm_table_s la_reasm_table;
@@ -32,6 +35,36 @@ typedef struct {
 	la_reasm_key_destroy_func *destroy_key;
 } la_reasm_table_funcs;
 
+// Fills a temporary lookup key for the given message in the storage
+// provided by the reassembly engine
+typedef void (la_reasm_fill_key_func)(void *key, void const *msg);
+
+// Maximum size of a temporary key built with la_reasm_fill_key_func
+#define LA_REASM_TMP_KEY_SIZE_MAX 64
+
+// Serializes the key into buf (if it's at least len bytes long).
+// Returns the length of the serialized key.
+typedef size_t (la_reasm_serialize_key_func)(void const *key, uint8_t *buf, size_t len);
+
+// Creates a key (like la_reasm_get_key_func) from its serialized form.
+// Returns NULL if the data is invalid.
+typedef void *(la_reasm_deserialize_key_func)(uint8_t const *buf, size_t len);
+
+typedef struct {
+	la_reasm_get_key_func *get_key;
+	la_reasm_fill_key_func *fill_tmp_key;
+	size_t tmp_key_size;
+	la_reasm_hash_func *hash_key;
+	la_reasm_compare_func *compare_keys;
+	la_reasm_key_destroy_func *destroy_key;
+	char const *name;                           // table name used in snapshots
+	la_reasm_serialize_key_func *serialize_key;
+	la_reasm_deserialize_key_func *deserialize_key;
+// reserved for future use
+	void (*reserved0)(void);
+	void (*reserved1)(void);
+} la_reasm_table_funcs_ex;
+
 #define SEQ_FIRST_NONE -1
 #define SEQ_WRAP_NONE -1
 
@@ -74,6 +107,25 @@ typedef struct {
 } la_reasm_fragment_info;
 
 #define LA_ALLOW_OUT_OF_ORDER_DELIVERY (1 << 0)     /* Allows out of order delivery of fragments */
+#define LA_REQUIRE_FIRST_FRAGMENT      (1 << 1)     /* Starts reassembly only with the fragment
+                                                       numbered seq_num_first */
+
+// A piece of reassembled payload
+typedef struct {
+	uint8_t const *base;
+	size_t len;
+} la_reasm_iovec;
+
+// Reassembled payload returned by la_reasm_payload_get_iov()
+typedef struct {
+	la_reasm_iovec *iov;            /* payload pieces in sequence order */
+	int iov_cnt;                    /* number of elements in iov */
+	int len;                        /* total payload length */
+	void *storage;                  /* memory holding the payload (private) */
+// reserved for future use
+	void (*reserved0)(void);
+	void (*reserved1)(void);
+} la_reasm_payload;
 
 typedef enum {
 	LA_REASM_UNKNOWN,
@@ -86,14 +138,53 @@ typedef enum {
 } la_reasm_status;
 #define LA_REASM_STATUS_MAX LA_REASM_ARGS_INVALID
 
+// Reassembly table statistics returned by la_reasm_table_stats_get()
+typedef struct {
+	void const *table_id;           /* table identifier */
+	char const *name;               /* table name (NULL if not set) */
+	uint64_t frags_added;           /* fragments passed to la_reasm_fragment_add() */
+	uint64_t status_cnt[LA_REASM_STATUS_MAX + 1];
+	                                /* la_reasm_fragment_add() results, indexed by status */
+	uint64_t expired_cnt;           /* messages discarded due to reassembly timeout */
+	uint64_t evicted_cnt;           /* messages discarded due to limits */
+	uint64_t completed_frags_cnt;   /* fragments of all completed messages */
+	double avg_frags_per_msg;       /* average number of fragments per completed message */
+	size_t entry_cnt;               /* messages currently being reassembled */
+	size_t byte_cnt;                /* memory currently used by these messages */
+	size_t peak_byte_cnt;           /* highest value of byte_cnt seen so far */
+// reserved for future use
+	void (*reserved0)(void);
+	void (*reserved1)(void);
+	void (*reserved2)(void);
+	void (*reserved3)(void);
+} la_reasm_table_stats;
+
 // reassembly.c
 la_reasm_ctx *la_reasm_ctx_new();
+la_reasm_ctx *la_reasm_ctx_new_sharded(int shard_cnt);
 void la_reasm_ctx_destroy(void *ctx);
+void la_reasm_ctx_config_set(la_reasm_ctx *rctx, la_config_snapshot const *snap);
+la_config_snapshot const *la_reasm_ctx_config_get(la_reasm_ctx const *rctx);
+void la_reasm_ctx_limits_set(la_reasm_ctx *rctx, size_t max_entries, size_t max_bytes);
+uint64_t la_reasm_ctx_eviction_cnt_get(la_reasm_ctx *rctx);
 la_reasm_table *la_reasm_table_new(la_reasm_ctx *rctx, void const *table_id,
 		la_reasm_table_funcs funcs, int cleanup_interval);
+la_reasm_table *la_reasm_table_new_ex(la_reasm_ctx *rctx, void const *table_id,
+		la_reasm_table_funcs_ex funcs, int cleanup_interval);
 la_reasm_table *la_reasm_table_lookup(la_reasm_ctx *rctx, void const *table_id);
+void la_reasm_table_limits_set(la_reasm_table *rtable, size_t max_entries, size_t max_bytes);
+uint64_t la_reasm_table_eviction_cnt_get(la_reasm_table *rtable);
+void la_reasm_table_stats_get(la_reasm_table *rtable, la_reasm_table_stats *stats);
+int la_reasm_ctx_stats_get(la_reasm_ctx *rctx, la_reasm_table_stats *stats, int max_cnt);
+size_t la_reasm_ctx_save(la_reasm_ctx *rctx, uint8_t **result);
+int la_reasm_ctx_load(la_reasm_ctx *rctx, uint8_t const *buf, size_t len);
+int la_reasm_ctx_expire(la_reasm_ctx *rctx, struct timeval now);
+bool la_reasm_ctx_next_deadline(la_reasm_ctx *rctx, struct timeval *result);
 la_reasm_status la_reasm_fragment_add(la_reasm_table *rtable, la_reasm_fragment_info const *finfo);
 int la_reasm_payload_get(la_reasm_table *rtable, void const *msg_info, uint8_t **result);
+int la_reasm_payload_get_iov(la_reasm_table *rtable, void const *msg_info,
+		la_reasm_payload *result);
+void la_reasm_payload_release(la_reasm_payload *payload);
 char const *la_reasm_status_name_get(la_reasm_status status);
 
 #ifdef __cplusplus
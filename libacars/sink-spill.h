@@ -0,0 +1,28 @@
+/*
+ *  This file is a part of libacars
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+
+#ifndef LA_SINK_SPILL_H
+#define LA_SINK_SPILL_H 1
+
+// Passing partial output of a protocol node to the sink (internal API).
+//
+// la_proto_tree_format_*_to_sink() format each protocol node into a staging
+// vstring, which is then written to the sink. Formatting routines which
+// may produce long output (message texts, payloads) call la_sink_spill()
+// every now and then, so that the staging vstring does not grow with the
+// size of the message.
+
+#include <stdbool.h>
+#include <libacars/vstring.h>           // la_vstring
+#include <libacars/sink.h>              // la_sink
+
+// sink.c
+int la_sink_write_vstring(la_sink *sink, la_vstring *vstr, bool hold_comma);
+void la_sink_spill_start(la_sink *sink, la_vstring *vstr, bool hold_comma);
+void la_sink_spill_stop(void);
+void la_sink_spill(la_vstring *vstr);
+
+#endif // !LA_SINK_SPILL_H
@@ -0,0 +1,219 @@
+/*
+ *  This file is a part of libacars
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+
+#include <stdbool.h>
+#include <stdint.h>                     // uint8_t, intptr_t
+#include <stdio.h>                      // FILE, fwrite
+#include <string.h>                     // memcpy
+#include <errno.h>                      // errno, EINTR
+#include "config.h"                     // HAVE_UNISTD_H
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>                     // write
+#elif defined(_WIN32)
+#include <io.h>                         // _write
+#define write _write
+#endif
+#include <libacars/macros.h>            // la_assert, LA_THREAD_LOCAL
+#include <libacars/util.h>              // LA_NEW, LA_XCALLOC, LA_XFREE
+#include <libacars/arena.h>             // la_arena_activate
+#include <libacars/vstring.h>           // la_vstring
+#include <libacars/sink.h>
+#include <libacars/sink-spill.h>
+
+// Staging vstring is passed to the sink by la_sink_spill() when it has
+// grown to at least this many bytes
+#define LA_SINK_SPILL_THRESHOLD 4096
+
+struct la_sink_s {
+	la_sink_write_func *write;
+	void *ctx;
+	uint8_t *buf;                       // output buffer (buffered sinks only)
+	size_t buf_size;
+	size_t buf_len;                     // number of bytes waiting in buf
+	bool error;                         // a write has failed; all further writes fail
+};
+
+// Staging vstring of the formatting operation in progress in the calling thread
+typedef struct {
+	la_sink *sink;
+	la_vstring *vstr;
+	bool hold_comma;
+} la_sink_spill_state;
+
+static LA_THREAD_LOCAL la_sink_spill_state spill_state;
+
+static la_sink *la_sink_new(la_sink_write_func *write, void *ctx, size_t buf_size) {
+	la_assert(write != NULL);
+	// Sinks usually outlive the processing of a single message,
+	// so they must never be allocated from the arena.
+	la_arena *saved_arena = la_arena_activate(NULL);
+	LA_NEW(la_sink, sink);
+	sink->write = write;
+	sink->ctx = ctx;
+	if(buf_size > 0) {
+		sink->buf = LA_XCALLOC(buf_size, sizeof(uint8_t));
+		sink->buf_size = buf_size;
+	}
+	la_arena_activate(saved_arena);
+	return sink;
+}
+
+static int la_sink_file_write(void *ctx, void const *buf, size_t len) {
+	return fwrite(buf, 1, len, (FILE *)ctx) == len ? 0 : -1;
+}
+
+static int la_sink_fd_write(void *ctx, void const *buf, size_t len) {
+	int fd = (int)(intptr_t)ctx;
+	uint8_t const *ptr = buf;
+	while(len > 0) {
+		// Do not rely on the OS accepting everything in one go
+		// (sockets and pipes might not)
+		unsigned int chunk = len > INT32_MAX ? INT32_MAX : (unsigned int)len;
+		int ret = (int)write(fd, ptr, chunk);
+		if(ret < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			return -1;
+		}
+		ptr += ret;
+		len -= (size_t)ret;
+	}
+	return 0;
+}
+
+static int la_sink_vstring_write(void *ctx, void const *buf, size_t len) {
+	la_vstring_append_buffer(ctx, buf, len);
+	return 0;
+}
+
+la_sink *la_sink_callback_new(la_sink_write_func *write, void *ctx) {
+	return la_sink_new(write, ctx, 0);
+}
+
+la_sink *la_sink_buffered_new(la_sink_write_func *write, void *ctx, size_t buf_size) {
+	la_assert(buf_size > 0);
+	return la_sink_new(write, ctx, buf_size);
+}
+
+la_sink *la_sink_file_new(FILE *f) {
+	la_assert(f != NULL);
+	return la_sink_new(la_sink_file_write, f, 0);
+}
+
+la_sink *la_sink_fd_new(int fd) {
+	la_assert(fd >= 0);
+	return la_sink_new(la_sink_fd_write, (void *)(intptr_t)fd, 0);
+}
+
+la_sink *la_sink_vstring_new(la_vstring *vstr) {
+	la_assert(vstr != NULL);
+	return la_sink_new(la_sink_vstring_write, vstr, 0);
+}
+
+static int la_sink_write_through(la_sink *sink, void const *buf, size_t len) {
+	if(len > 0 && sink->write(sink->ctx, buf, len) < 0) {
+		sink->error = true;
+		return -1;
+	}
+	return 0;
+}
+
+int la_sink_flush(la_sink *sink) {
+	la_assert(sink != NULL);
+	if(sink->error) {
+		return -1;
+	}
+	size_t len = sink->buf_len;
+	sink->buf_len = 0;
+	return la_sink_write_through(sink, sink->buf, len);
+}
+
+int la_sink_write(la_sink *sink, void const *buf, size_t len) {
+	la_assert(sink != NULL);
+	if(sink->error) {
+		return -1;
+	}
+	if(len == 0) {
+		return 0;
+	}
+	la_assert(buf != NULL);
+	if(sink->buf == NULL) {
+		return la_sink_write_through(sink, buf, len);
+	}
+	if(sink->buf_len + len > sink->buf_size) {
+		if(la_sink_flush(sink) < 0) {
+			return -1;
+		}
+		if(len >= sink->buf_size) {
+			// Would not fit anyway - skip the copy
+			return la_sink_write_through(sink, buf, len);
+		}
+	}
+	memcpy(sink->buf + sink->buf_len, buf, len);
+	sink->buf_len += len;
+	return 0;
+}
+
+bool la_sink_error(la_sink const *sink) {
+	la_assert(sink != NULL);
+	return sink->error;
+}
+
+void la_sink_destroy(la_sink *sink) {
+	if(sink == NULL) {
+		return;
+	}
+	(void)la_sink_flush(sink);
+	LA_XFREE(sink->buf);
+	LA_XFREE(sink);
+}
+
+// Passes the output accumulated in vstr to the sink and empties vstr.
+// If hold_comma is true, a trailing comma is kept in vstr, because
+// la_json_object_end() or la_json_array_end() might need to remove it later.
+int la_sink_write_vstring(la_sink *sink, la_vstring *vstr, bool hold_comma) {
+	la_assert(sink != NULL);
+	la_assert(vstr != NULL);
+	size_t len = vstr->len;
+	bool comma = hold_comma && len > 0 && vstr->str[len-1] == ',';
+	if(comma) {
+		len--;
+	}
+	int ret = la_sink_write(sink, vstr->str, len);
+	la_vstring_reset(vstr);
+	if(comma) {
+		la_vstring_append_char(vstr, ',');
+	}
+	return ret;
+}
+
+// Makes la_sink_spill() pass the contents of vstr to the sink in the
+// calling thread, until la_sink_spill_stop() is called
+void la_sink_spill_start(la_sink *sink, la_vstring *vstr, bool hold_comma) {
+	la_assert(sink != NULL);
+	la_assert(vstr != NULL);
+	spill_state = (la_sink_spill_state){
+		.sink = sink,
+		.vstr = vstr,
+		.hold_comma = hold_comma
+	};
+}
+
+void la_sink_spill_stop(void) {
+	spill_state = (la_sink_spill_state){ 0 };
+}
+
+// Passes the contents of vstr to the sink, if vstr is the staging vstring
+// of a formatting operation in progress and it has grown large enough.
+// Write errors are recorded in the sink and reported when the formatting
+// operation completes.
+void la_sink_spill(la_vstring *vstr) {
+	if(vstr != spill_state.vstr || vstr->len < LA_SINK_SPILL_THRESHOLD) {
+		return;
+	}
+	(void)la_sink_write_vstring(spill_state.sink, vstr, spill_state.hold_comma);
+}
@@ -0,0 +1,40 @@
+/*
+ *  This file is a part of libacars
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+
+#ifndef LA_SINK_H
+#define LA_SINK_H 1
+
+#include <stdbool.h>
+#include <stddef.h>         // size_t
+#include <stdio.h>          // FILE
+#include <libacars/vstring.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct la_sink_s la_sink;
+
+// Writes len bytes from buf to the destination described by ctx.
+// Returns 0 on success or a negative value on error.
+typedef int (la_sink_write_func)(void *ctx, void const *buf, size_t len);
+
+// sink.c
+la_sink *la_sink_callback_new(la_sink_write_func *write, void *ctx);
+la_sink *la_sink_buffered_new(la_sink_write_func *write, void *ctx, size_t buf_size);
+la_sink *la_sink_file_new(FILE *f);
+la_sink *la_sink_fd_new(int fd);
+la_sink *la_sink_vstring_new(la_vstring *vstr);
+int la_sink_write(la_sink *sink, void const *buf, size_t len);
+int la_sink_flush(la_sink *sink);
+bool la_sink_error(la_sink const *sink);
+void la_sink_destroy(la_sink *sink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !LA_SINK_H
@@ -11,14 +11,13 @@
 #include <limits.h>             // CHAR_BIT
 #include <errno.h>              // errno
 #include "config.h"             // HAVE_STRSEP, WITH_LIBXML2, WITH_JANSSON, HAVE_UNISTD_H
-#include "libacars.h"           // la_config_get_bool
+#include "configuration.h"      // la_config_current()
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>             // _exit
 #endif
 #ifdef WITH_LIBXML2
-#include <libxml/parser.h>      // xmlParseDoc
+#include <libxml/parser.h>      // xmlReadMemory, XML_PARSE_*
 #include <libxml/tree.h>        // xmlBuffer.*, xmlNodeDump, xmlDocGetRootElement, xmlFreeDoc
-#include <libxml/xmlerror.h>    // initGenericErrorDefaultFunc, xmlGenericError
 #endif
 #ifdef WITH_ZLIB
 #include <zlib.h>               // z_stream, inflateInit2(), inflate(), inflateEnd()
@@ -27,9 +26,24 @@
 #include <jansson.h>
 #endif
 #include <libacars/macros.h>    // la_debug_print()
+#include <libacars/arena.h>     // la_arena_current()
 #include <libacars/util.h>
 
+// Memory allocation wrappers. When an arena is active in the calling thread,
+// all allocations are served from it and la_xfree() becomes a no-op for
+// blocks owned by the arena. Blocks allocated from the heap are always freed
+// normally, regardless of whether an arena is active or not.
+
 void *la_xcalloc(size_t nmemb, size_t size, char const *file, int line, char const *func) {
+	la_arena *arena = la_arena_current();
+	if(arena != NULL) {
+		if(size != 0 && nmemb > SIZE_MAX / size) {
+			fprintf(stderr, "%s:%d: %s(): calloc(%zu, %zu) failed: size overflow\n",
+					file, line, func, nmemb, size);
+			_exit(1);
+		}
+		return la_arena_alloc(arena, nmemb * size);
+	}
 	void *ptr = calloc(nmemb, size);
 	if(ptr == NULL) {
 		fprintf(stderr, "%s:%d: %s(): calloc(%zu, %zu) failed: %s\n",
@@ -40,6 +54,10 @@ void *la_xcalloc(size_t nmemb, size_t size, char const *file, int line, char con
 }
 
 void *la_xrealloc(void *ptr, size_t size, char const *file, int line, char const *func) {
+	la_arena *arena = la_arena_current();
+	if(arena != NULL && (ptr == NULL || la_arena_owns(arena, ptr))) {
+		return la_arena_realloc(arena, ptr, size);
+	}
 	ptr = realloc(ptr, size);
 	if(ptr == NULL) {
 		fprintf(stderr, "%s:%d: %s(): realloc(%zu) failed: %s\n",
@@ -49,6 +67,25 @@ void *la_xrealloc(void *ptr, size_t size, char const *file, int line, char const
 	return ptr;
 }
 
+char *la_xstrdup(char const *s, char const *file, int line, char const *func) {
+	size_t len = strlen(s);
+	char *ptr = la_xcalloc(len + 1, sizeof(char), file, line, func);
+	memcpy(ptr, s, len);
+	return ptr;
+}
+
+void la_xfree(void *ptr) {
+	if(ptr == NULL) {
+		return;
+	}
+	la_arena *arena = la_arena_current();
+	if(arena != NULL && la_arena_owns(arena, ptr)) {
+		// Arena blocks are released all at once by la_arena_reset()
+		return;
+	}
+	free(ptr);
+}
+
 size_t la_slurp_hexstring(char* string, uint8_t **buf) {
 	if(string == NULL)
 		return 0;
@@ -80,8 +117,8 @@ size_t la_slurp_hexstring(char* string, uint8_t **buf) {
 
 char *la_hexdump(uint8_t *data, size_t len) {
 	static char const hex[] = "0123456789abcdef";
-	if(data == NULL) return strdup("<undef>");
-	if(len == 0) return strdup("<none>");
+	if(data == NULL) return LA_XSTRDUP("<undef>");
+	if(len == 0) return LA_XSTRDUP("<none>");
 
 	size_t rows = len / 16;
 	if((len & 0xf) != 0) {
@@ -184,6 +221,15 @@ size_t chomped_strlen(char const *s) {
 	return ret;
 }
 
+// copies at most maxlen characters of the string src to dst.
+// dst is not NUL-terminated - it's meant for zero-filled fixed-width
+// fields, eg. packed hash keys.
+void la_strpack(char *dst, char const *src, size_t maxlen) {
+	for(size_t i = 0; i < maxlen && src[i] != '\0'; i++) {
+		dst[i] = src[i];
+	}
+}
+
 // parse and perform basic sanitization of timestamp
 // in YYMMDDHHMMSS format.
 // Do not use strptime() - it's not available on WIN32
@@ -263,22 +309,15 @@ void *memmem(void const *haystack, size_t haystack_len, void const *needle, size
 #endif
 
 #ifdef WITH_LIBXML2
-void la_xml_errfunc_noop(void * ctx, char const *msg, ...) {
-	(void)ctx;
-	(void)msg;
-}
-
 xmlBufferPtr la_prettify_xml(char const *buf) {
 	if(buf == NULL) {
 		return NULL;
 	}
-	// Disables printing XML parser errors to stderr by setting error handler to noop.
-	// Can't do this once in library constructor, because this is a per-thread setting.
-	if(xmlGenericError != la_xml_errfunc_noop) {
-		xmlGenericErrorFunc errfuncptr = la_xml_errfunc_noop;
-		initGenericErrorDefaultFunc(&errfuncptr);
-	}
-	xmlDocPtr doc = xmlParseDoc((uint8_t const *)buf);
+	// Parser errors and warnings are suppressed with per-call parser options
+	// rather than by replacing libxml2's error handler, which is global
+	// (or per-thread, depending on libxml2 build options) state.
+	xmlDocPtr doc = xmlReadMemory(buf, strlen(buf), NULL, NULL,
+			XML_PARSE_NOERROR | XML_PARSE_NOWARNING | XML_PARSE_NONET);
 	if(doc == NULL) {
 		return NULL;
 	}
@@ -438,9 +477,7 @@ end:
 char *la_json_pretty_print(char const *json_string) {
 	la_assert(json_string);
 
-	bool prettify_json = false;
-	(void)la_config_get_bool("prettify_json", &prettify_json);
-	if(prettify_json == false) {
+	if(la_config_current(NULL)->prettify_json == false) {
 		return NULL;
 	}
 
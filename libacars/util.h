@@ -11,6 +11,7 @@
 #include <stdlib.h>         // free()
 #include <time.h>           // struct tm
 #include "config.h"         // HAVE_STRSEP, WITH_LIBXML2 WITH_ZLIB
+#include <libacars/arena.h> // la_arena
 #ifdef WITH_LIBXML2
 #include <libxml/tree.h>    // xmlBufferPtr
 #endif
@@ -22,10 +23,20 @@ typedef struct {
 
 void *la_xcalloc(size_t nmemb, size_t size, char const *file, int line, char const *func);
 void *la_xrealloc(void *ptr, size_t size, char const *file, int line, char const *func);
+char *la_xstrdup(char const *s, char const *file, int line, char const *func);
+void la_xfree(void *ptr);
 
 #define LA_XCALLOC(nmemb, size) la_xcalloc((nmemb), (size), __FILE__, __LINE__, __func__)
 #define LA_XREALLOC(ptr, size) la_xrealloc((ptr), (size), __FILE__, __LINE__, __func__)
-#define LA_XFREE(ptr) do { free(ptr); ptr = NULL; } while(0)
+#define LA_XSTRDUP(s) la_xstrdup((s), __FILE__, __LINE__, __func__)
+#define LA_XFREE(ptr) do { la_xfree(ptr); ptr = NULL; } while(0)
+
+// arena.c (internal part of the API)
+typedef void (la_arena_cleanup_func)(void *data);
+void *la_arena_alloc(la_arena *arena, size_t size);
+void *la_arena_realloc(la_arena *arena, void *ptr, size_t size);
+bool la_arena_owns(la_arena const *arena, void const *ptr);
+void la_arena_defer(la_arena *arena, la_arena_cleanup_func *func, void *data);
 
 #ifdef HAVE_STRSEP
 #include <string.h>
@@ -46,6 +57,7 @@ char *la_hexdump(uint8_t *data, size_t len);
 bool is_printable(uint8_t const *buf, uint32_t data_len);
 int la_strntouint16_t(char const *txt, int charcnt);
 size_t chomped_strlen(char const *s);
+void la_strpack(char *dst, char const *src, size_t maxlen);
 char *la_simple_strptime(char const *s, struct tm *t);
 la_octet_string *la_octet_string_new(void *buf, size_t len);
 void la_octet_string_destroy(void *ostring_ptr);
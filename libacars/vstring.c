@@ -9,15 +9,39 @@
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <string.h>                 // memcpy, strdup, strsep
-#include <libacars/macros.h>        // la_assert, la_debug_print
+#include <string.h>                 // memcpy, strlen, strdup, strsep
+#include <libacars/macros.h>        // la_assert, la_debug_print, LA_THREAD_LOCAL
 #include <libacars/util.h>          // LA_XCALLOC, LA_XFREE, LA_STRSEP
+#include <libacars/arena.h>         // la_arena_activate
 #include <libacars/vstring.h>       // la_vstring
+#include <libacars/sink-spill.h>    // la_sink_spill
 
 #define LA_VSTR_INITIAL_SIZE 256
 #define LA_VSTR_SIZE_MULT 2
 #define LA_VSTR_SIZE_MAX INT_MAX
 
+// Max number of decimal places handled by la_vstring_append_double
+// without resorting to vsnprintf
+#define LA_VSTR_DOUBLE_DECIMALS_MAX 9
+
+// Used by la_vstring_append_indent
+#define LA_VSTR_SPACES_LEN 64
+static char const la_vstring_spaces[LA_VSTR_SPACES_LEN + 1] =
+	"                                                                ";
+
+// Buffer pool size classes are powers of two, starting at LA_VSTR_INITIAL_SIZE.
+// Each class holds up to LA_VSTR_POOL_DEPTH free vstrings.
+#define LA_VSTR_POOL_CLASS_CNT 10
+#define LA_VSTR_POOL_DEPTH 4
+#define LA_VSTR_POOL_SIZE_MAX ((size_t)LA_VSTR_INITIAL_SIZE << LA_VSTR_POOL_CLASS_CNT)
+
+typedef struct {
+	la_vstring *items[LA_VSTR_POOL_DEPTH];
+	int cnt;
+} la_vstring_pool_class;
+
+static LA_THREAD_LOCAL la_vstring_pool_class la_vstring_pool[LA_VSTR_POOL_CLASS_CNT];
+
 static void la_vstring_grow(la_vstring *vstr, size_t space_needed) {
 	la_assert(vstr);
 
@@ -38,14 +62,24 @@ static size_t la_vstring_space_left(la_vstring const *vstr) {
 	return vstr->allocated_size - vstr->len;
 }
 
-la_vstring *la_vstring_new() {
+la_vstring *la_vstring_new_with_capacity(size_t capacity) {
+	la_assert(capacity < LA_VSTR_SIZE_MAX);
+	// Formatted output is handed over to the caller, who frees it with free(),
+	// so it must never be allocated from the arena. Subsequent reallocations
+	// of a heap block always go to the heap.
+	la_arena *saved_arena = la_arena_activate(NULL);
 	LA_NEW(la_vstring, vstr);
-	vstr->str = LA_XCALLOC(LA_VSTR_INITIAL_SIZE, sizeof(char));
-	vstr->allocated_size = LA_VSTR_INITIAL_SIZE;
+	vstr->allocated_size = capacity + 1;        // including '\0'
+	vstr->str = LA_XCALLOC(vstr->allocated_size, sizeof(char));
 	vstr->len = 0;
+	la_arena_activate(saved_arena);
 	return vstr;
 }
 
+la_vstring *la_vstring_new() {
+	return la_vstring_new_with_capacity(LA_VSTR_INITIAL_SIZE - 1);
+}
+
 void la_vstring_destroy(la_vstring *vstr, bool destroy_buffer) {
 	if(vstr && destroy_buffer == true) {
 		LA_XFREE(vstr->str);
@@ -53,6 +87,68 @@ void la_vstring_destroy(la_vstring *vstr, bool destroy_buffer) {
 	LA_XFREE(vstr);
 }
 
+void la_vstring_reset(la_vstring *vstr) {
+	la_assert(vstr);
+	la_assert(vstr->allocated_size > 0);
+	vstr->len = 0;
+	vstr->str[0] = '\0';
+}
+
+// Returns the number of the smallest pool size class which can hold
+// a string of the given length (or LA_VSTR_POOL_CLASS_CNT if none can).
+static int la_vstring_pool_class_for_len(size_t len) {
+	size_t class_size = LA_VSTR_INITIAL_SIZE;
+	int i = 0;
+	while(i < LA_VSTR_POOL_CLASS_CNT && len >= class_size) {
+		class_size *= LA_VSTR_SIZE_MULT;
+		i++;
+	}
+	return i;
+}
+
+la_vstring *la_vstring_pool_get(size_t capacity) {
+	int c = la_vstring_pool_class_for_len(capacity);
+	for(int i = c; i < LA_VSTR_POOL_CLASS_CNT; i++) {
+		la_vstring_pool_class *pc = &la_vstring_pool[i];
+		if(pc->cnt > 0) {
+			la_vstring *vstr = pc->items[--pc->cnt];
+			la_vstring_reset(vstr);
+			return vstr;
+		}
+	}
+	if(c < LA_VSTR_POOL_CLASS_CNT) {
+		// Round the capacity up to the class size, so that the buffer
+		// may be put back into the same class later.
+		return la_vstring_new_with_capacity(((size_t)LA_VSTR_INITIAL_SIZE << c) - 1);
+	}
+	return la_vstring_new_with_capacity(capacity);
+}
+
+void la_vstring_pool_put(la_vstring *vstr) {
+	if(vstr == NULL) {
+		return;
+	}
+	// Find the largest class not exceeding the buffer size. Buffers
+	// smaller than the smallest class or much larger than the largest one
+	// are not worth keeping.
+	int c = la_vstring_pool_class_for_len(vstr->allocated_size) - 1;
+	if(c >= 0 && vstr->allocated_size < LA_VSTR_POOL_SIZE_MAX &&
+			la_vstring_pool[c].cnt < LA_VSTR_POOL_DEPTH) {
+		la_vstring_pool[c].items[la_vstring_pool[c].cnt++] = vstr;
+		return;
+	}
+	la_vstring_destroy(vstr, true);
+}
+
+void la_vstring_pool_clear(void) {
+	for(int i = 0; i < LA_VSTR_POOL_CLASS_CNT; i++) {
+		la_vstring_pool_class *pc = &la_vstring_pool[i];
+		while(pc->cnt > 0) {
+			la_vstring_destroy(pc->items[--pc->cnt], true);
+		}
+	}
+}
+
 void la_isprintf_multiline_text(la_vstring *vstr, int indent, char const *txt) {
 	la_assert(vstr != NULL);
 	la_assert(indent >= 0);
@@ -60,12 +156,13 @@ void la_isprintf_multiline_text(la_vstring *vstr, int indent, char const *txt) {
 		return;
 	}
 	// have to work on a copy, because strsep modifies its first argument
-	char *copy = strdup(txt);
+	char *copy = LA_XSTRDUP(txt);
 	char *ptr = copy;
 	char *line = NULL;
 	do {
 		line = LA_STRSEP(&ptr, "\n");
 		LA_ISPRINTF(vstr, indent, "%s\n", line);
+		la_sink_spill(vstr);
 	} while(ptr != NULL && ptr[0] != '\0');
 	LA_XFREE(copy);
 }
@@ -116,3 +213,138 @@ void la_vstring_append_buffer(la_vstring *vstr, void const *buffer, size_t len)
 	vstr->str[vstr->len] = '\0';
 	return;
 }
+
+void la_vstring_reserve(la_vstring *vstr, size_t len) {
+	la_assert(vstr);
+	if(len >= la_vstring_space_left(vstr)) {
+		la_vstring_grow(vstr, len);
+	}
+}
+
+void la_vstring_append_string(la_vstring *vstr, char const *str) {
+	la_assert(str);
+	la_vstring_append_buffer(vstr, str, strlen(str));
+}
+
+void la_vstring_append_char(la_vstring *vstr, char c) {
+	la_assert(vstr);
+	if(la_vstring_space_left(vstr) < 2) {
+		la_vstring_grow(vstr, 1);
+	}
+	vstr->str[vstr->len++] = c;
+	vstr->str[vstr->len] = '\0';
+}
+
+void la_vstring_append_indent(la_vstring *vstr, int indent) {
+	la_assert(vstr);
+	// Never let a negative indent turn into a huge length
+	if(indent <= 0) {
+		return;
+	}
+	size_t len = (size_t)indent;
+	while(len > LA_VSTR_SPACES_LEN) {
+		la_vstring_append_buffer(vstr, la_vstring_spaces, LA_VSTR_SPACES_LEN);
+		len -= LA_VSTR_SPACES_LEN;
+	}
+	la_vstring_append_buffer(vstr, la_vstring_spaces, len);
+}
+
+// Writes the decimal representation of val into the buffer ending
+// at end (exclusive). Returns a pointer to the first character.
+static char *la_u64toa(char *end, uint64_t val) {
+	do {
+		*--end = (char)('0' + val % 10);
+		val /= 10;
+	} while(val != 0);
+	return end;
+}
+
+void la_vstring_append_int64(la_vstring *vstr, int64_t val) {
+	char buf[24];
+	char *end = buf + sizeof(buf);
+	char *ptr = la_u64toa(end, val < 0 ? -(uint64_t)val : (uint64_t)val);
+	if(val < 0) {
+		*--ptr = '-';
+	}
+	la_vstring_append_buffer(vstr, ptr, (size_t)(end - ptr));
+}
+
+// Appends val with the given number of decimal places. The result is
+// identical to "%.*f" - the exact binary value is rounded to nearest, ties
+// to even - but for the magnitudes seen in decoded messages it is computed
+// with integer arithmetic only. This is not a shortest round-trip conversion
+// (like Ryu), as that would change the output format.
+void la_vstring_append_double(la_vstring *vstr, double val, int decimals) {
+	la_assert(vstr);
+	la_assert(decimals >= 0);
+
+	uint64_t bits;
+	memcpy(&bits, &val, sizeof(bits));
+	bool negative = (bits >> 63) != 0;
+	int exponent = (int)((bits >> 52) & 0x7ff);
+	uint64_t mantissa = bits & ((UINT64_C(1) << 52) - 1);
+
+	uint64_t int_part = 0, frac_part = 0;
+	// val = mantissa / 2^shift
+	int shift = 0;
+	if(decimals > LA_VSTR_DOUBLE_DECIMALS_MAX || exponent == 0x7ff ||
+			(exponent == 0 && mantissa != 0)) {
+		// Too many digits requested, Inf, NaN or subnormal
+		goto fallback;
+	}
+	if(exponent != 0) {
+		mantissa |= UINT64_C(1) << 52;
+		shift = 1075 - exponent;
+	}
+	if(shift <= 0) {
+		if(shift < -10) {               // does not fit in int64
+			goto fallback;
+		}
+		int_part = mantissa << -shift;
+	} else if(shift <= 60) {
+		// Produce the fractional digits one by one. remainder * 10
+		// never overflows, since remainder < 2^shift <= 2^60.
+		int_part = mantissa >> shift;
+		uint64_t mask = (UINT64_C(1) << shift) - 1;
+		uint64_t remainder = mantissa & mask;
+		for(int i = 0; i < decimals; i++) {
+			remainder *= 10;
+			frac_part = frac_part * 10 + (remainder >> shift);
+			remainder &= mask;
+		}
+		uint64_t half = UINT64_C(1) << (shift - 1);
+		uint64_t last_digit = decimals > 0 ? frac_part : int_part;
+		if(remainder > half || (remainder == half && (last_digit & 1) != 0)) {
+			uint64_t limit = 1;
+			for(int i = 0; i < decimals; i++) {
+				limit *= 10;
+			}
+			if(++frac_part == limit) {
+				frac_part = 0;
+				int_part++;
+			}
+		}
+	} else {                            // |val| < 2^-7 - would need more precision
+		goto fallback;
+	}
+
+	char buf[48];
+	char *end = buf + sizeof(buf);
+	char *ptr = end;
+	if(decimals > 0) {
+		char *frac_start = end - decimals;
+		ptr = la_u64toa(end, frac_part);
+		while(ptr > frac_start) {
+			*--ptr = '0';
+		}
+		*--ptr = '.';
+	}
+	ptr = la_u64toa(ptr, int_part);
+	if(negative) {
+		*--ptr = '-';
+	}
+	la_vstring_append_buffer(vstr, ptr, (size_t)(end - ptr));
+	return;
+fallback:
+	la_vstring_append_sprintf(vstr, "%.*f", decimals, val);
+}
@@ -9,6 +9,7 @@
 
 #include <stddef.h>         // size_t
 #include <stdbool.h>
+#include <stdint.h>         // int64_t
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,9 +26,12 @@ extern "C" {
 #endif
 
 // la_vstring_append_sprintf with variable indentation
-#define LA_ISPRINTF(vstr, i, f, ...) la_vstring_append_sprintf(vstr, "%*s" f, i, "", ##__VA_ARGS__)
+#define LA_ISPRINTF(vstr, i, f, ...) do { \
+	la_vstring_append_indent((vstr), (i)); \
+	la_vstring_append_sprintf((vstr), f, ##__VA_ARGS__); \
+} while(0)
 
-#define LA_EOL(x) la_vstring_append_sprintf((x), "%s", "\n")
+#define LA_EOL(x) la_vstring_append_char((x), '\n')
 
 typedef struct {
 	char *str;              // string buffer pointer
@@ -36,10 +40,21 @@ typedef struct {
 } la_vstring;
 
 la_vstring *la_vstring_new();
+la_vstring *la_vstring_new_with_capacity(size_t capacity);
 void la_vstring_destroy(la_vstring *vstr, bool destroy_buffer);
+void la_vstring_reset(la_vstring *vstr);
+la_vstring *la_vstring_pool_get(size_t capacity);
+void la_vstring_pool_put(la_vstring *vstr);
+void la_vstring_pool_clear(void);
 void la_vstring_append_sprintf(la_vstring *vstr, char const *fmt, ...) LA_GCC_PRINTF_ATTR(2, 3);
 void la_vstring_append_buffer(la_vstring *vstr, void const *buffer, size_t size);
 void la_isprintf_multiline_text(la_vstring *vstr, int indent, char const *txt);
+void la_vstring_reserve(la_vstring *vstr, size_t len);
+void la_vstring_append_string(la_vstring *vstr, char const *str);
+void la_vstring_append_char(la_vstring *vstr, char c);
+void la_vstring_append_indent(la_vstring *vstr, int indent);
+void la_vstring_append_int64(la_vstring *vstr, int64_t val);
+void la_vstring_append_double(la_vstring *vstr, double val, int decimals);
 
 #ifdef __cplusplus
 }
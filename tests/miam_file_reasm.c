@@ -0,0 +1,91 @@
+/*
+ *  miam_file_reasm - checks reassembly of MIAM file transfers
+ *
+ *  Copyright (c) 2018-2023 Tomasz Lemiech <szpajder@gmail.com>
+ */
+#include <stdbool.h>            /* bool */
+#include <stdio.h>              /* printf(), fprintf() */
+#include <sys/time.h>           /* struct timeval */
+#include <libacars/libacars.h>  /* la_proto_node, la_proto_tree_destroy() */
+#include <libacars/miam.h>      /* la_miam_parse_and_reassemble(), la_miam_file_segment_msg */
+#include <libacars/reassembly.h>    /* la_reasm_ctx, la_reasm_ctx_stats_get() */
+
+#define REG "SP-LRA"
+/* File Transfer Request: file ID 1, 100 bytes */
+#define FILE_REQUEST "F001000100230101120000"
+/* Segments of file 1. The payload is a MIAM CORE PDU with a bogus version,
+ * which is decoded into an error node. */
+#define FILE_SEGMENT_1 "S001001-0Q)[:+|Hello"
+#define FILE_SEGMENT_2 "S001002-0Q)[:+|Hello"
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+	if(!(cond)) { \
+		fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+		failures++; \
+	} \
+} while(0)
+
+static struct timeval rx_time = { .tv_sec = 1672574400, .tv_usec = 0 };
+
+static size_t entry_cnt(la_reasm_ctx *rctx) {
+	la_reasm_table_stats stats[4];
+	int cnt = la_reasm_ctx_stats_get(rctx, stats, 4);
+	size_t result = 0;
+	for(int i = 0; i < cnt; i++) {
+		result += stats[i].entry_cnt;
+	}
+	return result;
+}
+
+/* Parses a File Segment frame and checks its reassembly status and
+ * whether its payload has been decoded */
+static void segment_check(la_reasm_ctx *rctx, char const *txt,
+		la_reasm_status expected_status, bool expect_payload) {
+	la_proto_node *node = la_miam_parse_and_reassemble(REG, txt, rctx, rx_time);
+	CHECK(node != NULL);
+	if(node != NULL) {
+		la_proto_node *seg_node = node->next;
+		CHECK(seg_node != NULL);
+		if(seg_node != NULL) {
+			la_miam_file_segment_msg *seg = seg_node->data;
+			CHECK(seg->reasm_status == expected_status);
+			CHECK((seg_node->next != NULL) == expect_payload);
+		}
+	}
+	la_proto_tree_destroy(node);
+}
+
+/* A segment without a preceding File Transfer Request can't be reassembled.
+ * It must not create a reassembly table entry and its payload must be decoded. */
+static void orphan_segment_test() {
+	la_reasm_ctx *rctx = la_reasm_ctx_new();
+	segment_check(rctx, FILE_SEGMENT_2, LA_REASM_FRAG_OUT_OF_SEQUENCE, true);
+	segment_check(rctx, FILE_SEGMENT_1, LA_REASM_FRAG_OUT_OF_SEQUENCE, true);
+	CHECK(entry_cnt(rctx) == 0);
+	la_reasm_ctx_destroy(rctx);
+}
+
+/* Segments following a File Transfer Request may arrive in any order */
+static void reordered_segment_test() {
+	la_reasm_ctx *rctx = la_reasm_ctx_new();
+	la_proto_tree_destroy(la_miam_parse_and_reassemble(REG, FILE_REQUEST, rctx, rx_time));
+	CHECK(entry_cnt(rctx) == 1);
+	/* decode_fragments is false by default */
+	segment_check(rctx, FILE_SEGMENT_2, LA_REASM_IN_PROGRESS, false);
+	segment_check(rctx, FILE_SEGMENT_1, LA_REASM_IN_PROGRESS, false);
+	CHECK(entry_cnt(rctx) == 1);
+	la_reasm_ctx_destroy(rctx);
+}
+
+int main() {
+	orphan_segment_test();
+	reordered_segment_test();
+	if(failures > 0) {
+		printf("%d check(s) failed\n", failures);
+		return 1;
+	}
+	printf("OK\n");
+	return 0;
+}